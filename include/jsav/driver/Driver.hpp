@@ -0,0 +1,105 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "../lexer/Lexer.hpp"
+#include "WorkStealingPool.hpp"
+
+namespace jsv {
+
+    /// Per-file work done by `Driver`, in order. New phases go before `Count`.
+    enum class Phase : std::uint8_t { Read, Lex, Count };
+
+    [[nodiscard]] constexpr std::string_view phaseToString(const Phase phase) noexcept {
+        switch(phase) {
+        case Phase::Read:
+            return "read";
+        case Phase::Lex:
+            return "lex";
+        default:
+            return "?";
+        }
+    }
+
+    /// CPU time spent in each phase, summed over every file and thread.
+    using PhaseTimes = std::array<std::chrono::nanoseconds, static_cast<std::size_t>(Phase::Count)>;
+
+    /// Outcome of one file.
+    struct FileReport {
+        std::string path;
+        std::size_t bytes = 0;
+        std::size_t tokens = 0;  ///< `Eof` included.
+        bool failed = false;     ///< Could not be read or lexed.
+        /// `path:line:column: error: message` in source order, or the
+        /// `error: message` of a file that could not be read.
+        std::vector<std::string> diagnostics;
+        /// With `Driver::keep_tokens`, the file and its tokens; released once
+        /// the report is delivered.
+        std::shared_ptr<const vnd::SourceBuffer> source;
+        TokenStream stream;
+    };
+
+    /// Append to `out` a `path:line:column: error: unexpected '...'` diagnostic,
+    /// in source order, for every `Error` token of `tokens` lexed from `text`.
+    void append_error_diagnostics(const TokenStream &tokens, std::string_view text, std::string_view path, std::vector<std::string> &out);
+
+    /// `path:position: error: unexpected '...'` for an `Error` token whose
+    /// source is `text`, quoting at most its first line and 32 bytes.
+    [[nodiscard]] std::string unexpected_token_diagnostic(std::string_view path, std::string_view position, std::string_view text);
+
+    /// Totals of a `Driver::run`.
+    struct DriverSummary {
+        std::size_t files = 0;
+        std::size_t failed = 0;
+        std::size_t bytes = 0;
+        std::size_t tokens = 0;
+        std::size_t diagnostics = 0;
+        std::chrono::nanoseconds wall{};
+        PhaseTimes cpu{};
+    };
+
+    /// Runs the per-file phases over many files on a `WorkStealingPool`.
+    ///
+    /// Each file is read, then lexed by a follow-up task that its worker runs
+    /// next, while the buffer is hot; idle workers steal whole files. Files
+    /// are independent, so there is no shared lexer state. Reports are
+    /// handed to the callback in input order however the work was scheduled,
+    /// so output is deterministic. Workers start files in input order too, so
+    /// reports are delivered as the run progresses, and each report (and its
+    /// buffer) is released once delivered. At most `window()` files, counted
+    /// from the next report to deliver, are in flight; the rest start as
+    /// reports are delivered, so one slow file holds back a bounded number of
+    /// finished reports and their tokens.
+    class Driver {
+    public:
+        /// Called once per file, in input order, never concurrently.
+        using ReportCallback = std::function<void(const FileReport &)>;
+
+        /// Files in flight per worker; enough to keep every worker busy.
+        static constexpr std::size_t files_per_job = 4;
+
+        /// @param jobs Worker threads; 0 uses `std::thread::hardware_concurrency()`.
+        /// @param keep_tokens Hand each file's buffer and tokens to the callback
+        ///        in its `FileReport`, e.g. to dump them.
+        explicit Driver(std::size_t jobs = 0, bool keep_tokens = false) : m_pool{jobs}, m_keep_tokens{keep_tokens} {}
+
+        /// Process `paths` and return the totals. `on_report` may be empty.
+        /// If it throws, no further file is started or reported, and the
+        /// exception is rethrown once the files in flight have finished.
+        DriverSummary run(std::span<const std::string> paths, const ReportCallback &on_report = {});
+
+        [[nodiscard]] std::size_t jobs() const noexcept { return m_pool.size(); }
+        [[nodiscard]] bool keep_tokens() const noexcept { return m_keep_tokens; }
+        /// Most files read, lexed or waiting for delivery at once.
+        [[nodiscard]] std::size_t window() const noexcept { return jobs() * files_per_job; }
+
+    private:
+        WorkStealingPool m_pool;
+        bool m_keep_tokens;
+    };
+
+}  // namespace jsv
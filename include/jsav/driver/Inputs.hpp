@@ -0,0 +1,96 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include <span>
+
+namespace jsv {
+
+    /// Source file extension searched for in directory inputs.
+    inline constexpr std::string_view source_extension = ".vn";
+
+    /// True if `c` makes a path component a glob pattern.
+    [[nodiscard]] constexpr bool is_glob_char(const char c) noexcept { return c == '*' || c == '?' || c == '['; }
+
+    /// True if the command-line `input` is a glob pattern: it has glob
+    /// characters and does not name an existing file or directory.
+    [[nodiscard]] bool is_glob_input(const std::string &input);
+
+    /// True if the path component `name` matches the glob `pattern`: `*` matches
+    /// any run of bytes, `?` one byte, `[abc]`, `[a-z]` and `[!a]` one byte of
+    /// (or not of) a set. An unclosed `[` matches itself.
+    [[nodiscard]] constexpr bool glob_match(const std::string_view pattern, const std::string_view name) noexcept {
+        std::size_t p = 0;
+        std::size_t n = 0;
+        // Backtrack point: just after the last `*`, and the name byte it was tried at.
+        std::size_t star = std::string_view::npos;
+        std::size_t star_n = 0;
+        while(n < name.size()) {
+            bool matched = false;
+            std::size_t next = p + 1;
+            if(p < pattern.size()) {
+                if(pattern[p] == '*') {
+                    star = ++p;
+                    star_n = n;
+                    continue;
+                }
+                if(pattern[p] == '?') {
+                    matched = true;
+                } else if(pattern[p] == '[') {
+                    const auto close = pattern.find(']', p + 2);
+                    if(close == std::string_view::npos) {
+                        matched = name[n] == '[';
+                    } else {
+                        const bool negate = pattern[p + 1] == '!';
+                        bool in_set = false;
+                        for(auto i = p + 1 + (negate ? 1U : 0U); i < close; ++i) {
+                            if(i + 2 < close && pattern[i + 1] == '-') {
+                                in_set = in_set || (pattern[i] <= name[n] && name[n] <= pattern[i + 2]);
+                                i += 2;
+                            } else {
+                                in_set = in_set || pattern[i] == name[n];
+                            }
+                        }
+                        matched = in_set != negate;
+                        next = close + 1;
+                    }
+                } else {
+                    matched = pattern[p] == name[n];
+                }
+            }
+            if(matched) {
+                p = next;
+                ++n;
+            } else if(star != std::string_view::npos) {
+                p = star;
+                n = ++star_n;
+            } else {
+                return false;
+            }
+        }
+        while(p < pattern.size() && pattern[p] == '*') { ++p; }
+        return p == pattern.size();
+    }
+
+    /// Files named by command-line inputs.
+    struct InputFiles {
+        /// In argument order, each directory or pattern's matches sorted;
+        /// a file named twice is kept once.
+        std::vector<std::string> files;
+        /// One message per pattern or directory that matched no file.
+        std::vector<std::string> errors;
+    };
+
+    /// Expand command-line inputs into files. A directory stands for every
+    /// `source_extension` file under it, recursively; a path with glob
+    /// characters in any component for the files it matches, where a `**`
+    /// component matches any number of directories, unless it names an
+    /// existing path; anything else for itself (a missing file is left for
+    /// the reader to report).
+    [[nodiscard]] InputFiles collect_inputs(std::span<const std::string> inputs);
+
+}  // namespace jsv
@@ -0,0 +1,96 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "../lexer/LineIndex.hpp"
+#include "../lexer/StreamingLexer.hpp"
+#include "../lexer/TokenStream.hpp"
+#include <cstdio>
+
+namespace jsv {
+
+    /// Layout of a token dump.
+    enum class TokenFormat : std::uint8_t {
+        Text,   ///< `Kind("text") path:line:column`, one token per line.
+        Jsonl,  ///< One JSON object per line.
+        Binary  ///< `TokenWriter::binary_magic`, then per file a header record and
+                ///< fixed-size little-endian token records ending with its `Eof`.
+    };
+
+    [[nodiscard]] constexpr std::optional<TokenFormat> parseTokenFormat(const std::string_view name) noexcept {
+        if(name == "text") { return TokenFormat::Text; }
+        if(name == "jsonl") { return TokenFormat::Jsonl; }
+        if(name == "binary") { return TokenFormat::Binary; }
+        return std::nullopt;
+    }
+
+    /// Dumps tokens through one large buffer.
+    ///
+    /// Tokens are formatted straight into a `fmt::memory_buffer` that is
+    /// written out in `flush_bytes` blocks, so dumping allocates nothing per
+    /// token: the path is formatted once per file, and lines come from a
+    /// `LineIndex` walked forward with a hint. Quotes, backslashes, control
+    /// bytes and invalid UTF-8 in token text are escaped, so every record
+    /// stays on one line.
+    class TokenWriter {
+    public:
+        /// Buffered bytes that trigger a write.
+        static constexpr std::size_t flush_bytes = std::size_t{1} << 20U;
+        /// First bytes of a binary dump. Each file then starts with a header
+        /// record: `binary_file_kind` (1 byte), the path length (4) and the
+        /// path bytes. Each token record that follows is the kind (1 byte),
+        /// offset in that file (8), length (4) and payload (4), little-endian.
+        static constexpr std::string_view binary_magic = "JSVTOK1\n";
+        static constexpr std::size_t binary_record_bytes = 17;
+        /// Kind byte of a file header record; no `TokenKind` uses it.
+        static constexpr std::uint8_t binary_file_kind = 0xFF;
+        static_assert(static_cast<std::uint8_t>(TokenKind::Error) < binary_file_kind);
+
+        /// Write to `out`, which must stay open while the writer lives.
+        TokenWriter(std::FILE *out, TokenFormat format) noexcept : m_out{out}, m_format{format} {}
+
+        TokenWriter(const TokenWriter &) = delete;
+        TokenWriter &operator=(const TokenWriter &) = delete;
+        TokenWriter(TokenWriter &&) = delete;
+        TokenWriter &operator=(TokenWriter &&) = delete;
+        /// Writes what is still buffered; call `flush` first to see errors.
+        ~TokenWriter();
+
+        /// Name the file the next tokens come from. In a binary dump this
+        /// writes the file's header record.
+        void set_file(std::string_view path);
+
+        /// Dump every token of `tokens`, lexed from `source`.
+        void write(const TokenStream &tokens, std::string_view source);
+
+        /// Dump one streamed token. Its line is not known, so the text
+        /// formats give its offset instead.
+        void write(const StreamToken &token);
+
+        /// Write out the buffer.
+        /// @throws std::system_error If the output cannot be written.
+        void flush();
+
+        /// Bytes handed to the output so far, not counting the buffer.
+        [[nodiscard]] std::size_t bytes_written() const noexcept { return m_written; }
+
+    private:
+        void emit(TokenKind kind, std::string_view text, std::uint64_t offset, std::uint32_t length, std::uint32_t payload,
+                  const SourceLocation *location);
+        void append_escaped(std::string_view text);
+        /// Write `binary_magic` unless already out.
+        void start_binary();
+
+        std::FILE *m_out;
+        TokenFormat m_format;
+        fmt::memory_buffer m_buffer;
+        std::string m_path;  ///< As printed: truncated for text, escaped for JSON.
+        bool m_started = false;  ///< The binary header is out.
+        std::size_t m_written = 0;
+    };
+
+}  // namespace jsv
@@ -0,0 +1,84 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace jsv {
+
+    /// Fixed set of worker threads, each with its own task deque, plus one
+    /// shared FIFO.
+    ///
+    /// A task submitted by a task (e.g. the lex phase of a file just read)
+    /// goes to the back of its worker's deque and runs next, while its data
+    /// is still in cache. Tasks submitted from outside the pool, or through
+    /// `submit_fifo`, join the shared FIFO, so they start in submission
+    /// order. A worker pops from the back of its own deque; when it is empty
+    /// it takes the oldest task of the FIFO, and only when that is empty too
+    /// steals from the front of another worker's deque. `wait` blocks until
+    /// every task, including the ones submitted meanwhile, has run.
+    class WorkStealingPool {
+    public:
+        using Task = std::function<void()>;
+
+        /// Start `threads` workers; 0 uses `std::thread::hardware_concurrency()`.
+        explicit WorkStealingPool(std::size_t threads = 0);
+
+        WorkStealingPool(const WorkStealingPool &) = delete;
+        WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+        WorkStealingPool(WorkStealingPool &&) = delete;
+        WorkStealingPool &operator=(WorkStealingPool &&) = delete;
+        /// Finishes the queued tasks, then joins the workers.
+        ~WorkStealingPool();
+
+        /// Queue `task`: on the calling worker's deque when called from a
+        /// task, on the shared FIFO otherwise.
+        void submit(Task task);
+
+        /// Queue `task` at the back of the shared FIFO, even from a task, so
+        /// it starts after every task already there.
+        void submit_fifo(Task task);
+
+        /// Block until no task is queued or running.
+        /// @throws The first exception a task threw since the last `wait`.
+        void wait();
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_queues.size(); }
+
+        /// Tasks taken from another worker's deque so far.
+        [[nodiscard]] std::size_t steals() const noexcept { return m_steals.load(std::memory_order_relaxed); }
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+        /// Push `task` on `queue`, at the back, and count it.
+        void enqueue(Queue &queue, Task task);
+        /// Pop the back of worker `self`'s deque, else the front of the FIFO,
+        /// else steal the front of another worker's deque.
+        [[nodiscard]] std::optional<Task> take(std::size_t self);
+        void work(const std::stop_token &stop, std::size_t self);
+
+        std::vector<std::unique_ptr<Queue>> m_queues;
+        Queue m_fifo;                           ///< Outside and `submit_fifo` tasks.
+        std::atomic<std::size_t> m_steals{0};
+        std::mutex m_mutex;                     ///< Guards the counters below and the waits.
+        std::condition_variable_any m_wake;     ///< A task was queued (or stop requested).
+        std::condition_variable m_idle;         ///< `m_pending` reached 0.
+        std::size_t m_pending = 0;              ///< Tasks queued or running.
+        std::size_t m_queued = 0;               ///< Tasks queued, not yet taken.
+        std::exception_ptr m_error;
+        std::vector<std::jthread> m_workers;    ///< Declared last: joined before the rest is destroyed.
+    };
+
+}  // namespace jsv
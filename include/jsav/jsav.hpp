@@ -11,5 +11,18 @@
 #include "lexer/SourceLocation.hpp"
 #include "lexer/SourceSpan.hpp"
 #include "lexer/Token.hpp"
+#include "lexer/CompactToken.hpp"
+#include "lexer/Arena.hpp"
+#include "lexer/Interner.hpp"
+#include "lexer/NumericLiteral.hpp"
+#include "lexer/StringTable.hpp"
+#include "lexer/SourceFile.hpp"
+#include "lexer/SourceManager.hpp"
+#include "lexer/TokenStream.hpp"
 #include "lexer/Lexer.hpp"
+#include "lexer/StreamingLexer.hpp"
+#include "driver/WorkStealingPool.hpp"
+#include "driver/Inputs.hpp"
+#include "driver/Driver.hpp"
+#include "driver/TokenWriter.hpp"
 // clang-format on
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+
+namespace jsv {
+
+    /// Bump allocator for text that must outlive the source buffer.
+    ///
+    /// Bytes are carved from 64 KiB blocks (or one block of exactly the
+    /// request, when larger) and never moved, so views into the arena stay
+    /// valid for its lifetime. Nothing is freed before the arena itself.
+    class Arena {
+    public:
+        /// Copy `text` into the arena.
+        [[nodiscard]] std::string_view store(std::string_view text);
+
+        /// Room for up to `size` bytes at the end of the arena; write into it,
+        /// then `commit` the part actually used. Invalidated by the next call.
+        [[nodiscard]] char *reserve(std::size_t size);
+
+        /// Keep the first `used` bytes of the last `reserve` and view them.
+        std::string_view commit(std::size_t used) noexcept;
+
+        /// Blocks allocated so far.
+        [[nodiscard]] std::size_t block_count() const noexcept { return m_blocks.size(); }
+
+    private:
+        static constexpr std::size_t block_size = std::size_t{64} << 10U;
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;  // NOLINT(*-avoid-c-arrays)
+        char *m_cursor = nullptr;  ///< Next free byte of the last block.
+        std::size_t m_block_left = 0;
+    };
+
+}  // namespace jsv
@@ -0,0 +1,133 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace jsv {
+
+    /// Byte classes used by the lexer dispatch and scanners.
+    ///
+    /// Each byte maps to a bitmask of these flags through `char_class_table`;
+    /// query it with `has_char_class` or the `is_ascii_*` helpers below.
+    /// Unlike `<cctype>`, the table is locale-independent, constexpr, and costs
+    /// one load per query; it matches the "C" locale for every ASCII byte.
+    enum class CharClass : std::uint8_t {
+        Digit = 1U << 0U,          ///< `0`–`9`
+        HexDigit = 1U << 1U,       ///< `0`–`9`, `a`–`f`, `A`–`F`
+        Alpha = 1U << 2U,          ///< `a`–`z`, `A`–`Z`
+        IdentStart = 1U << 3U,     ///< Alpha or `_`
+        IdentContinue = 1U << 4U,  ///< Alpha, Digit or `_`
+        Whitespace = 1U << 5U,     ///< Horizontal whitespace: space, `\t`, `\r`, `\v`, `\f`
+        OperatorStart = 1U << 6U,  ///< First byte of an operator or punctuation token
+        NonAscii = 1U << 7U,       ///< 0x80–0xFF (lead or continuation byte)
+    };
+
+    /// Union of two class sets, for queries such as `Alpha | Digit`.
+    [[nodiscard]] constexpr CharClass operator|(const CharClass lhs, const CharClass rhs) noexcept {
+        return static_cast<CharClass>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+    }
+
+    namespace detail {
+
+        [[nodiscard]] consteval std::array<std::uint8_t, 256> make_char_class_table() noexcept {
+            std::array<std::uint8_t, 256> table{};
+            const auto add = [&table](std::string_view chars, CharClass cls) {
+                for(const char c : chars) { table[static_cast<unsigned char>(c)] |= static_cast<std::uint8_t>(cls); }
+            };
+            constexpr std::string_view digits = "0123456789";
+            constexpr std::string_view letters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+            using enum CharClass;
+            add(digits, Digit | HexDigit | IdentContinue);
+            add("abcdefABCDEF", HexDigit);
+            add(letters, Alpha | IdentStart | IdentContinue);
+            add("_", IdentStart | IdentContinue);
+            add(" \t\r\v\f", Whitespace);
+            add("+-*/<>!^%|&=:,.;()[]{}", OperatorStart);
+            for(std::size_t b = 0x80; b < table.size(); ++b) { table[b] |= static_cast<std::uint8_t>(NonAscii); }
+            return table;
+        }
+
+    }  // namespace detail
+
+    /// Class bitmask for every byte value, indexed by `unsigned char`.
+    inline constexpr std::array<std::uint8_t, 256> char_class_table = detail::make_char_class_table();
+
+    /// True iff `c` belongs to any of the classes in `mask`.
+    [[nodiscard]] constexpr bool has_char_class(const char c, const CharClass mask) noexcept {
+        return (char_class_table[static_cast<unsigned char>(c)] & static_cast<std::uint8_t>(mask)) != 0;
+    }
+
+    [[nodiscard]] constexpr bool is_ascii_digit(const char c) noexcept { return has_char_class(c, CharClass::Digit); }
+
+    [[nodiscard]] constexpr bool is_ascii_hex_digit(const char c) noexcept { return has_char_class(c, CharClass::HexDigit); }
+
+    /// Value of an ASCII hex digit (which includes the decimal, octal and binary ones).
+    [[nodiscard]] constexpr unsigned hex_digit_value(const char c) noexcept {
+        if(c >= '0' && c <= '9') { return static_cast<unsigned>(c - '0'); }
+        return static_cast<unsigned>((c | 0x20) - 'a' + 10);
+    }
+
+    /// Letters and digits only — `_` is not alphanumeric (matches `std::isalnum`).
+    [[nodiscard]] constexpr bool is_ascii_alnum(const char c) noexcept { return has_char_class(c, CharClass::Alpha | CharClass::Digit); }
+
+    [[nodiscard]] constexpr bool is_ascii_ident_start(const char c) noexcept { return has_char_class(c, CharClass::IdentStart); }
+
+    [[nodiscard]] constexpr bool is_ascii_ident_continue(const char c) noexcept { return has_char_class(c, CharClass::IdentContinue); }
+
+    [[nodiscard]] constexpr bool is_ascii_horizontal_space(const char c) noexcept {
+        return has_char_class(c, CharClass::Whitespace);
+    }
+
+    /// What `Lexer::scan_token` does with the first byte of a token.
+    enum class TokenStart : std::uint8_t {
+        Other,       ///< No token starts with this byte: one `Error` byte.
+        Digit,       ///< Decimal numeric literal.
+        Dot,         ///< Numeric literal if a digit follows, else `Dot`.
+        Hash,        ///< `#b` / `#o` / `#x` literal.
+        String,      ///< `"` string literal.
+        Char,        ///< `'` char literal.
+        Identifier,  ///< ASCII identifier or keyword.
+        NonAscii,    ///< Unicode identifier, or an `Error` sequence.
+        Operator,    ///< Operator or punctuation.
+    };
+
+    namespace detail {
+
+        [[nodiscard]] consteval std::array<TokenStart, 256> make_token_start_table() noexcept {
+            std::array<TokenStart, 256> table{};
+            for(std::size_t b = 0; b < table.size(); ++b) {
+                const auto c = static_cast<char>(b);
+                using enum TokenStart;
+                if(has_char_class(c, CharClass::Digit)) {
+                    table[b] = Digit;
+                } else if(has_char_class(c, CharClass::IdentStart)) {
+                    table[b] = Identifier;
+                } else if(has_char_class(c, CharClass::NonAscii)) {
+                    table[b] = NonAscii;
+                } else if(has_char_class(c, CharClass::OperatorStart)) {
+                    table[b] = Operator;
+                }
+            }
+            table['.'] = TokenStart::Dot;
+            table['#'] = TokenStart::Hash;
+            table['"'] = TokenStart::String;
+            table['\''] = TokenStart::Char;
+            return table;
+        }
+
+    }  // namespace detail
+
+    /// First-byte dispatch for `Lexer::scan_token`, indexed by `unsigned char`:
+    /// one load and a jump table replace the chain of class tests.
+    inline constexpr std::array<TokenStart, 256> token_start_table = detail::make_token_start_table();
+
+}  // namespace jsv
+
+// NOLINTEND(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
@@ -0,0 +1,51 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "Token.hpp"
+
+namespace jsv {
+
+    /// Fixed-size token record: kind, byte range, file id and payload only.
+    ///
+    /// A `Token` carries its text view and a full `SourceSpan` (~90 bytes);
+    /// this keeps the 16 bytes needed to recover both from the owning source
+    /// (see `SourceFile`). Offsets are 32-bit, so a single source is limited
+    /// to 4 GiB. The payload is the `SymbolId` of an identifier, the
+    /// `LiteralId` of a numeric literal or the `StringId` of a string/char
+    /// literal; the kind tells which.
+    class CompactToken {
+    public:
+        constexpr CompactToken() noexcept = default;
+
+        constexpr CompactToken(const TokenKind kind, const std::uint32_t offset, const std::uint32_t length, const FileId file_id = 0,
+                               const std::uint32_t payload = no_symbol) noexcept
+          : m_offset{offset}, m_length{length}, m_payload{payload}, m_file_id{file_id}, m_kind{kind} {}
+
+        [[nodiscard]] constexpr TokenKind getKind() const noexcept { return m_kind; }
+        [[nodiscard]] constexpr std::uint32_t getOffset() const noexcept { return m_offset; }
+        [[nodiscard]] constexpr std::uint32_t getLength() const noexcept { return m_length; }
+        [[nodiscard]] constexpr std::uint32_t getEndOffset() const noexcept { return m_offset + m_length; }
+        [[nodiscard]] constexpr FileId getFileId() const noexcept { return m_file_id; }
+        [[nodiscard]] constexpr SymbolId getSymbol() const noexcept { return isIdentifier(m_kind) ? m_payload : no_symbol; }
+        [[nodiscard]] constexpr LiteralId getLiteral() const noexcept { return isNumericLiteral(m_kind) ? m_payload : no_literal; }
+        [[nodiscard]] constexpr StringId getString() const noexcept { return isTextLiteral(m_kind) ? m_payload : no_string; }
+        [[nodiscard]] constexpr std::uint32_t getPayload() const noexcept { return m_payload; }
+
+        [[nodiscard]] constexpr bool operator==(const CompactToken &other) const noexcept = default;
+
+    private:
+        std::uint32_t m_offset = 0;  ///< Byte offset of the first byte in the source.
+        std::uint32_t m_length = 0;  ///< Length of the token text in bytes.
+        std::uint32_t m_payload = no_symbol;
+        FileId m_file_id = 0;
+        TokenKind m_kind = TokenKind::Eof;
+    };
+
+    static_assert(sizeof(CompactToken) <= 16, "CompactToken must stay within 16 bytes");
+    static_assert(std::is_trivially_copyable_v<CompactToken>);
+
+}  // namespace jsv
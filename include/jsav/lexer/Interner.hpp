@@ -0,0 +1,88 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "Arena.hpp"
+#include "Token.hpp"
+
+namespace jsv {
+
+    namespace detail {
+
+        inline constexpr std::uint64_t symbol_hash_seed = 0xCBF29CE484222325ULL;
+        inline constexpr std::uint64_t symbol_hash_prime = 0x100000001B3ULL;
+
+        /// One FNV-1a step. The lexer folds identifier bytes in as it scans
+        /// them, so interning never rereads the name.
+        [[nodiscard]] constexpr std::uint64_t symbol_hash_step(const std::uint64_t hash, const char c) noexcept {
+            return (hash ^ C_UC(c)) * symbol_hash_prime;
+        }
+
+        /// Hash of a whole name; equal to folding every byte with `symbol_hash_step`.
+        [[nodiscard]] constexpr std::uint64_t symbol_hash(const std::string_view text) noexcept {
+            auto hash = symbol_hash_seed;
+            for(const char c : text) { hash = symbol_hash_step(hash, c); }
+            return hash;
+        }
+
+    }  // namespace detail
+
+    /// Counters kept by `Interner`.
+    struct InternerStats {
+        std::size_t symbols = 0;       ///< Unique names.
+        std::size_t lookups = 0;       ///< Names interned, repeats included.
+        std::size_t bytes_seen = 0;    ///< Bytes of every interned name, repeats included.
+        std::size_t bytes_stored = 0;  ///< Bytes kept in the arena: one copy per unique name.
+
+        [[nodiscard]] std::size_t bytes_saved() const noexcept { return bytes_seen - bytes_stored; }
+    };
+
+    /// Identifier symbol table: maps each distinct name to a dense `SymbolId`
+    /// (0, 1, 2, ... in first-seen order).
+    ///
+    /// Names are copied once into an `Arena`, so the views returned by `name`
+    /// stay valid for the interner's lifetime, independent of the source
+    /// buffer. Lookup is open addressing with linear probing
+    /// over (hash, id) slots; the full 64-bit hash is compared before the
+    /// bytes, and the table doubles at 50% load.
+    class Interner {
+    public:
+        Interner();
+
+        /// Id of `text`, adding it if new.
+        SymbolId intern(std::string_view text);
+
+        /// Same, with `hash == detail::symbol_hash(text)` already computed.
+        SymbolId intern(std::string_view text, std::uint64_t hash);
+
+        /// Id of `text`, or `no_symbol` if it was never interned.
+        [[nodiscard]] SymbolId find(std::string_view text) const noexcept;
+
+        /// Interned name of `id`.
+        [[nodiscard]] std::string_view name(const SymbolId id) const noexcept { return m_names[id]; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_names.size(); }
+        [[nodiscard]] const InternerStats &stats() const noexcept { return m_stats; }
+
+    private:
+        struct Slot {
+            std::uint64_t hash = 0;
+            SymbolId id = no_symbol;  ///< `no_symbol` marks an empty slot.
+        };
+
+        std::vector<Slot> m_slots;
+        std::vector<std::string_view> m_names;
+        Arena m_arena;
+        InternerStats m_stats;
+
+        /// Slot holding `text`, or the empty slot where it would go.
+        [[nodiscard]] std::size_t probe(std::string_view text, std::uint64_t hash) const noexcept;
+
+        void grow();
+    };
+
+}  // namespace jsv
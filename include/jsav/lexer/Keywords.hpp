@@ -0,0 +1,127 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
+
+#pragma once
+
+#include "Token.hpp"
+
+namespace jsv {
+
+    /// One reserved word and the token kind it lexes to.
+    struct KeywordEntry {
+        std::string_view text;
+        TokenKind kind;
+    };
+
+    /// Every keyword and primitive type name, sorted lexicographically.
+    /// Adding an entry here is all that is needed: the perfect hash below is
+    /// regenerated at compile time and a `static_assert` rejects collisions.
+    inline constexpr std::array<KeywordEntry, 25> keyword_list{{
+        {"bool", TokenKind::KeywordBool},
+        {"break", TokenKind::KeywordBreak},
+        {"char", TokenKind::TypeChar},
+        {"const", TokenKind::KeywordConst},
+        {"continue", TokenKind::KeywordContinue},
+        {"else", TokenKind::KeywordElse},
+        {"f32", TokenKind::TypeF32},
+        {"f64", TokenKind::TypeF64},
+        {"for", TokenKind::KeywordFor},
+        {"fun", TokenKind::KeywordFun},
+        {"i16", TokenKind::TypeI16},
+        {"i32", TokenKind::TypeI32},
+        {"i64", TokenKind::TypeI64},
+        {"i8", TokenKind::TypeI8},
+        {"if", TokenKind::KeywordIf},
+        {"main", TokenKind::KeywordMain},
+        {"nullptr", TokenKind::KeywordNullptr},
+        {"return", TokenKind::KeywordReturn},
+        {"string", TokenKind::TypeString},
+        {"u16", TokenKind::TypeU16},
+        {"u32", TokenKind::TypeU32},
+        {"u64", TokenKind::TypeU64},
+        {"u8", TokenKind::TypeU8},
+        {"var", TokenKind::KeywordVar},
+        {"while", TokenKind::KeywordWhile},
+    }};
+
+    namespace detail {
+
+        /// Number of hash slots (power of two, so the reduction is a mask).
+        inline constexpr std::size_t keyword_slot_count = 128;
+
+        /// Multipliers of the keyword hash; `{0, 0}` means "none found".
+        struct KeywordHashParams {
+            std::size_t mul_first;
+            std::size_t mul_last;
+        };
+
+        /// Hash keyed on length plus first and last byte — no loop over the text.
+        [[nodiscard]] constexpr std::size_t keyword_hash(const std::size_t length, const char first, const char last,
+                                                         const KeywordHashParams params) noexcept {
+            return (static_cast<unsigned char>(first) * params.mul_first + static_cast<unsigned char>(last) * params.mul_last + length) &
+                   (keyword_slot_count - 1);
+        }
+
+        [[nodiscard]] constexpr std::size_t keyword_hash(const std::string_view text, const KeywordHashParams params) noexcept {
+            return keyword_hash(text.size(), text.front(), text.back(), params);
+        }
+
+        /// Search the smallest multipliers that send every keyword to its own slot.
+        [[nodiscard]] consteval KeywordHashParams find_keyword_hash_params() noexcept {
+            for(std::size_t mul_first = 1; mul_first < 64; ++mul_first) {
+                for(std::size_t mul_last = 1; mul_last < 64; ++mul_last) {
+                    std::array<bool, keyword_slot_count> used{};
+                    bool collision = false;
+                    for(const auto &entry : keyword_list) {
+                        const auto slot = keyword_hash(entry.text, {mul_first, mul_last});
+                        collision = collision || used[slot];
+                        used[slot] = true;
+                    }
+                    if(!collision) { return {mul_first, mul_last}; }
+                }
+            }
+            return {0, 0};
+        }
+
+        inline constexpr KeywordHashParams keyword_hash_params = find_keyword_hash_params();
+        static_assert(keyword_hash_params.mul_first != 0, "no collision-free keyword hash: grow keyword_slot_count");
+
+        /// Slot table; unused slots hold an empty text, which never matches a word.
+        [[nodiscard]] consteval std::array<KeywordEntry, keyword_slot_count> build_keyword_slots() noexcept {
+            std::array<KeywordEntry, keyword_slot_count> slots{};
+            for(auto &slot : slots) { slot = {"", TokenKind::IdentifierAscii}; }
+            for(const auto &entry : keyword_list) { slots[keyword_hash(entry.text, keyword_hash_params)] = entry; }
+            return slots;
+        }
+
+        inline constexpr std::array<KeywordEntry, keyword_slot_count> keyword_slots = build_keyword_slots();
+
+        static_assert(
+            [] {
+                for(const auto &entry : keyword_list) {
+                    if(keyword_slots[keyword_hash(entry.text, keyword_hash_params)].text != entry.text) { return false; }
+                }
+                return true;
+            }(),
+            "keyword hash collision: two keywords share a slot");
+
+    }  // namespace detail
+
+    /// Map a lexed ASCII word to its keyword/type kind, or `IdentifierAscii`.
+    ///
+    /// One hash of (length, first byte, last byte) selects the only candidate;
+    /// most identifiers are rejected by the length compare, and a match costs a
+    /// single final byte compare of the whole word.
+    [[nodiscard]] constexpr TokenKind classify_keyword(const std::string_view text) noexcept {
+        if(text.empty()) { return TokenKind::IdentifierAscii; }
+        const auto &slot = detail::keyword_slots[detail::keyword_hash(text, detail::keyword_hash_params)];
+        if(slot.text.size() == text.size() && slot.text == text) { return slot.kind; }
+        return TokenKind::IdentifierAscii;
+    }
+
+}  // namespace jsv
+
+// NOLINTEND(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
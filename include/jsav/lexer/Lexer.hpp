@@ -6,12 +6,58 @@
 #pragma once
 
 #include "../headers.hpp"
+#include "CharClass.hpp"
+#include "CompactToken.hpp"
+#include "Interner.hpp"
+#include "Keywords.hpp"
+#include "LineIndex.hpp"
+#include "NumericLiteral.hpp"
+#include "Operators.hpp"
+#include "SourceManager.hpp"
+#include "StringTable.hpp"
+#include "TokenStream.hpp"
 #include "Token.hpp"
+#include "simd/ByteScan.hpp"
+#include "unicode/Utf8.hpp"
 
 namespace jsv {
-    [[nodiscard]] static constexpr bool is_ascii_horizontal_space(const char c) noexcept {
-        return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
-    }
+    class TokenRange;
+
+    /// A single replacement in a source buffer, in bytes of the old text:
+    /// `removed` bytes at `offset` were replaced by `inserted` new bytes.
+    struct TextEdit {
+        std::size_t offset = 0;
+        std::size_t removed = 0;
+        std::size_t inserted = 0;
+    };
+
+    /// Token indices touched by `Lexer::relex`: `removed` old tokens starting
+    /// at index `first` were replaced by `inserted` new ones.
+    struct RelexResult {
+        std::size_t first = 0;
+        std::size_t removed = 0;
+        std::size_t inserted = 0;
+    };
+
+    /// Side tables the lexer fills while scanning, each off when null. A
+    /// token's payload indexes the table of its kind (see `CompactToken`).
+    /// Not owned; they must outlive the lexing calls.
+    struct LexTables {
+        Interner *interner = nullptr;      ///< Identifier names.
+        LiteralTable *literals = nullptr;  ///< Numeric literal values.
+        StringTable *strings = nullptr;    ///< Decoded string and char literals.
+    };
+
+    /// Tuning for `Lexer::tokenize_parallel_into`.
+    struct ParallelLexOptions {
+        /// Worker count; 0 uses `std::thread::hardware_concurrency()`.
+        std::size_t threads = 0;
+        /// Smallest chunk worth a thread; smaller inputs are lexed sequentially.
+        std::size_t min_chunk_bytes = std::size_t{1} << 20U;
+        /// File id stamped on the stream; unset uses the lexer's own.
+        std::optional<FileId> file_id;
+    };
+
     /// UTF-8 aware lexer that produces a flat stream of `Token`s from source text.
     ///
     /// # Design notes
@@ -19,9 +65,13 @@ namespace jsv {
     ///   underlying buffer alive for the lifetime of any produced tokens (since
     ///   `Token::m_text` is also a view into the same buffer).
     /// - Line/column tracking is 1-indexed, column is byte-based (matching
-    ///   `SourceLocation` documentation).
+    ///   `SourceLocation` documentation). The scanners only move a byte offset;
+    ///   positions are resolved by a forward `LineCursor` when a `Token` is
+    ///   built, and never by `tokenize_compact`.
     /// - UTF-8 multi-byte sequences are decoded for identifier classification
     ///   (Unicode XID); all other scanning is byte-oriented for performance.
+    /// - Runs of horizontal whitespace and line-comment bodies are skipped with
+    ///   the block scanners in `simd/ByteScan.hpp` (SSE2/AVX2 with a scalar tail).
     ///
     /// # Numeric literal syntax
     /// | Kind        | Prefix | Example            |
@@ -42,87 +92,251 @@ namespace jsv {
     class Lexer {
     public:
         /// @param source    Complete source text to lex.
-        /// @param file_path Path used in diagnostics / span data.
-        explicit Lexer(std::string_view source, std::string file_path);
+        /// @param file_path Path used in diagnostics.
+        /// @param file_id   Id stamped on every span and token.
+        explicit Lexer(std::string_view source, std::string file_path, FileId file_id = 0);
+
+        /// Lex a loaded `vnd::SourceBuffer` in place, without copying it. The
+        /// buffer must outlive the lexer and every token it produces.
+        /// Its zero padding lets the scanners run bounds-check free, stopping
+        /// on the NUL sentinel instead (see `is_sentinel_terminated`).
+        explicit Lexer(const vnd::SourceBuffer &source, std::string file_path);
+        Lexer(vnd::SourceBuffer &&source, std::string file_path) = delete;
+
+        /// Lex source `file_id` of `sources` in sentinel mode; spans and
+        /// tokens carry `file_id`. The manager must outlive the tokens.
+        Lexer(const SourceManager &sources, FileId file_id);
+
+        [[nodiscard]] FileId file_id() const noexcept { return m_file_id; }
+
+        /// True when lexing from a padded `vnd::SourceBuffer`. Tokens are the
+        /// same either way; only the end-of-input checks differ.
+        [[nodiscard]] bool is_sentinel_terminated() const noexcept { return m_sentinel; }
 
         /// Lex all tokens including the terminating `Eof`.
         [[nodiscard]] std::vector<Token> tokenize();
 
+        /// Lex all tokens including the terminating `Eof` into 16-byte
+        /// `CompactToken`s tagged with `file_id` (the lexer's own by default).
+        /// Text and spans are recovered through a `SourceFile` over the same buffer.
+        /// @throws std::length_error if the source is 4 GiB or larger.
+        [[nodiscard]] std::vector<CompactToken> tokenize_compact(FileId file_id);
+        [[nodiscard]] std::vector<CompactToken> tokenize_compact() { return tokenize_compact(m_file_id); }
+
+        /// Lex all tokens including the terminating `Eof` into `out`, replacing
+        /// its contents but keeping its capacity, so one stream can be reused
+        /// across files. Tokens are tagged with `file_id` (the lexer's own by default).
+        /// @throws std::length_error if the source is 4 GiB or larger.
+        void tokenize_into(TokenStream &out, FileId file_id);
+        void tokenize_into(TokenStream &out) { tokenize_into(out, m_file_id); }
+
+        /// Same result as `tokenize_into`, lexed by several threads.
+        ///
+        /// The source is cut into chunks just after a `\n`; each chunk is lexed
+        /// speculatively from its first byte, as if no comment or literal were
+        /// open there. The chunks are then stitched in order: the lexer resumes
+        /// after the last trusted token and re-lexes until it produces a token
+        /// starting where a speculative token starts — lexing depends only on
+        /// the position, so from that token on the speculation is exact.
+        /// A chunk that begins inside a block comment or literal is therefore
+        /// re-lexed only up to the first token both runs agree on.
+        /// With side tables set, the tokens they describe are re-scanned after
+        /// stitching, in source order, so their ids match the sequential lexer.
+        /// @throws std::length_error if the source is 4 GiB or larger.
+        void tokenize_parallel_into(TokenStream &out, const ParallelLexOptions &options = {});
+
+        /// Update `tokens` — the full `tokenize_into` result for the text before
+        /// `edit` — to match `new_source`, the text after it.
+        ///
+        /// Lexing restarts after the last token whose lookahead cannot reach the
+        /// edit, and stops at the first new token that starts past the edit at
+        /// the (shifted) offset of an old token of the same kind: from there on
+        /// the text, and so the tokens, are the old ones moved by the edit delta.
+        /// Comments and literals opened or closed by the edit just move that
+        /// sync point further. Only the new tokens are lexed; the tail is
+        /// shifted in place. Non-ASCII text in the window is decoded checked
+        /// rather than validating all of `new_source`, so the cost does not
+        /// grow with the file. Re-lexed tokens are added to `tables` — the ones
+        /// the old tokens were lexed with. Entries of replaced literals stay in
+        /// their tables, unreferenced.
+        /// @throws std::length_error if `new_source` is 4 GiB or larger.
+        static RelexResult relex(TokenStream &tokens, const TextEdit &edit, std::string_view new_source, const LexTables &tables = {});
+
+        /// Intern every identifier into `interner` as it is scanned and tag its
+        /// token with the resulting `SymbolId`; `nullptr` (the default) turns
+        /// interning off. The interner must outlive the lexing calls.
+        void set_interner(Interner *interner) noexcept { m_tables.interner = interner; }
+        [[nodiscard]] Interner *interner() const noexcept { return m_tables.interner; }
+
+        /// Decode every numeric literal as it is scanned — integer value with
+        /// overflow flag, or double, plus base and suffix — into `literals`,
+        /// and tag its token with the resulting `LiteralId`; `nullptr` (the
+        /// default) turns decoding off. The table must outlive the lexing calls.
+        void set_literal_table(LiteralTable *literals) noexcept { m_tables.literals = literals; }
+        [[nodiscard]] LiteralTable *literal_table() const noexcept { return m_tables.literals; }
+
+        /// Record every string and char literal in `strings` — the body as a
+        /// source view when it has no escape, decoded once otherwise — and tag
+        /// its token with the resulting `StringId`; `nullptr` (the default)
+        /// turns this off. Malformed (`Error`) literals get no entry.
+        void set_string_table(StringTable *strings) noexcept { m_tables.strings = strings; }
+        [[nodiscard]] StringTable *string_table() const noexcept { return m_tables.strings; }
+
+        /// Set all three side tables at once.
+        void set_tables(const LexTables &tables) noexcept { m_tables = tables; }
+        [[nodiscard]] const LexTables &tables() const noexcept { return m_tables; }
+
+        /// Lazy input range over the remaining tokens, ending with `Eof`.
+        /// Each increment lexes one token and lines are counted as it goes, so
+        /// memory stays O(1) however large the source; composes with
+        /// `std::views` (e.g. `filter`, `take`).
+        /// The range advances this lexer and must not outlive it.
+        [[nodiscard]] TokenRange tokens() noexcept;
+
         /// Produce the next single token from the stream.
         /// After `Eof` is returned, subsequent calls keep returning `Eof`.
         [[nodiscard]] Token next_token();
 
     private:
+        friend class StreamingLexer;
+
+        /// Bytes a scanner may read past the end of its token (e.g. `1i32` +
+        /// digit check, or a codepoint decode); 8 leaves a margin.
+        static constexpr std::size_t max_lookahead = 8;
+
         // ── Source state ──────────────────────────────────────────────────
         std::string_view m_source;  ///< Non-owning view of the full input.
-        std::size_t m_pos = 0;      ///< Current byte offset (0-indexed).
-        std::size_t m_line = 1;     ///< Current line (1-indexed).
-        std::size_t m_column = 1;   ///< Current column, byte-based (1-indexed).
-        std::string m_file_path;
+        bool m_sentinel = false;    ///< `vnd::SourceBuffer::padding` zero bytes follow `m_source`.
+        std::size_t m_pos = 0;          ///< Current byte offset (0-indexed).
+        std::size_t m_token_start = 0;  ///< Offset of the token last scanned by `scan_token`.
+        std::string m_file_path;        ///< Used in diagnostics only; spans carry `m_file_id`.
+        FileId m_file_id = 0;
+        LineCursor m_line_cursor;          ///< Resolves the forward-moving token positions.
+        std::optional<LineIndex> m_lines;  ///< Built only for a lookup behind the cursor.
+        std::size_t m_line_hint = 0;       ///< Line of the last `m_lines` lookup (0-indexed).
+        std::optional<unicode::Utf8Validation> m_utf8;  ///< Built on the first non-ASCII decode.
+        bool m_validate_utf8 = true;                    ///< False decodes every sequence checked, never building `m_utf8`.
+        LexTables m_tables;                             ///< Side tables to fill; none by default.
+        std::uint32_t m_payload = no_symbol;            ///< Side-table id of the token last scanned by `scan_token`.
+        NumericLiteral m_literal;                       ///< Value of the numeric literal being scanned.
 
         // ── Navigation ────────────────────────────────────────────────────
-        [[nodiscard]] bool is_at_end() const noexcept;
+        // The scanners are templates over an input policy (see Lexer.cpp):
+        // `CheckedInput` bounds-checks every read, `SentinelInput` reads the
+        // zero padding of a `vnd::SourceBuffer` past the end instead, so a
+        // scan stops on the sentinel byte and compares positions only there.
+        // The public entry points pick one per call from `m_sentinel`.
+        template <typename Input> [[nodiscard]] bool is_at_end() const noexcept;
+
+        /// `scan_token` with the input policy selected by `m_sentinel`.
+        [[nodiscard]] TokenKind scan_next();
+
+        /// Skip a UTF-8 BOM (0xEF 0xBB 0xBF) at the start of the input (FR-019).
+        /// Called by the constructor, so every entry point starts past it.
+        void skip_bom() noexcept;
+
+        /// Initial token capacity to reserve for the whole source.
+        [[nodiscard]] std::size_t estimated_token_count() const noexcept;
+
+        /// True if a side table is set for tokens of `kind`.
+        [[nodiscard]] bool has_table_for(TokenKind kind) const noexcept;
+
+        /// Throw std::length_error if offsets would not fit in 32 bits.
+        void check_compact_limit() const;
+
+        /// Chunk boundaries for parallel lexing: `m_pos`, then line starts near
+        /// evenly spaced offsets, then `m_source.size()`.
+        [[nodiscard]] std::vector<std::size_t> parallel_chunk_bounds(std::size_t chunks) const noexcept;
+
+        /// Append tokens from `m_pos` to `out` until one starts at or after
+        /// `end` (not appended) or `Eof` (appended).
+        void tokenize_range_into(TokenStream &out, std::size_t end);
 
         /// Peek the raw byte at `m_pos + offset` without consuming. Returns '\0' at EOF.
-        [[nodiscard]] char peek_byte(std::size_t offset = 0) const noexcept;
+        template <typename Input> [[nodiscard]] char peek_byte(std::size_t offset = 0) const noexcept;
 
-        /// Consume one raw byte, incrementing column. Does NOT handle newlines.
+        /// Consume one raw byte.
         char advance_byte() noexcept;
 
+        /// Consume every byte in [m_pos, new_pos).
+        void advance_bytes_to(std::size_t new_pos) noexcept;
+
         // ── UTF-8 helpers ─────────────────────────────────────────────────
 
-        /// Decode the codepoint at `m_pos` without consuming.
-        [[nodiscard]] char32_t peek_codepoint() const noexcept;
+        /// Whole-source UTF-8 validation, run once on first use.
+        [[nodiscard]] const unicode::Utf8Validation &utf8_validation();
 
-        /// Decode and consume one UTF-8 codepoint, updating line/column correctly.
-        char32_t advance_codepoint() noexcept;
+        /// Decode the sequence at `offset` without consuming. Sequence starts
+        /// outside the invalid ranges of `utf8_validation()` take the unchecked
+        /// decoder; everything else keeps the full `Utf8Status` classification.
+        /// With `m_validate_utf8` off every sequence takes the checked decoder.
+        [[nodiscard]] unicode::Utf8DecodeResult decode_at(std::size_t offset);
 
-        /// Advance m_pos and m_column by one UTF-8 sequence, marking has_malformed if invalid.
-        /// Used in string/char literal scanning to handle non-ASCII bytes.
-        void advance_with_utf8_check(bool &has_malformed) noexcept;
+        /// Advance m_pos by one UTF-8 sequence, marking has_malformed if invalid.
+        /// Used in char literal scanning to handle non-ASCII bytes.
+        void advance_with_utf8_check(bool &has_malformed);
 
         // ── Location / token construction ─────────────────────────────────
-        [[nodiscard]] SourceLocation current_location() const noexcept;
-        [[nodiscard]] SourceSpan make_span(const SourceLocation &start) const;
-        [[nodiscard]] Token make_token(TokenKind kind, std::string_view text, const SourceLocation &start) const;
-        [[nodiscard]] Token error_token(std::string_view text, const SourceLocation &start) const;
+        /// Line/column of `offset`: scanned forward from the previous lookup,
+        /// or from a line index built on demand for an earlier offset.
+        [[nodiscard]] SourceLocation resolve_location(std::size_t offset);
+
+        /// Build the `Token` for the source range [start, m_pos).
+        [[nodiscard]] Token make_token(TokenKind kind, std::size_t start);
+
+        /// Skip trivia and scan one token into [m_token_start, m_pos) and `m_payload`.
+        template <typename Input> [[nodiscard]] TokenKind scan_token();
 
         /// Return the source slice [text_start, m_pos) as a string_view.
         /// Extracted from the `text` lambda in scan_operator_or_punctuation.
         [[nodiscard]] std::string_view current_text(std::size_t text_start) const noexcept;
 
         // ── Whitespace / comments ─────────────────────────────────────────
-        void skip_whitespace_and_comments();
+        template <typename Input> void skip_whitespace_and_comments();
 
         /// Handle non-ASCII Unicode whitespace at current position.
         /// Returns true if whitespace was consumed, false if it was not whitespace.
-        [[nodiscard]] bool skip_unicode_whitespace() noexcept;
+        [[nodiscard]] bool skip_unicode_whitespace();
 
         /// Consume a block comment starting after the opening `/*`.
-        void skip_block_comment();
+        template <typename Input> void skip_block_comment();
 
         // ── Scanners ──────────────────────────────────────────────────────
-        Token scan_identifier_or_keyword(const SourceLocation &start, bool seen_unicode);
-        Token scan_numeric_literal(const SourceLocation &start);
-        template <typename IsDigit>
-        Token scan_based_literal(const std::size_t text_start, const SourceLocation &start, const TokenKind kind, IsDigit is_digit);
-        Token scan_hash_numeric(const SourceLocation &start);
-        Token scan_string_literal(const SourceLocation &start);
-        Token scan_char_literal(const SourceLocation &start);
-        Token scan_operator_or_punctuation(const SourceLocation &start);
+        // Each consumes one token starting at m_pos and returns its kind.
+        template <typename Input> TokenKind scan_identifier_or_keyword(bool seen_unicode);
+        template <typename Input> TokenKind scan_numeric_literal();
+        template <typename Input, unsigned Base, typename IsDigit> TokenKind scan_based_literal(const TokenKind kind, IsDigit is_digit);
+        template <typename Input> TokenKind scan_hash_numeric();
+        template <typename Input> TokenKind scan_string_literal();
+        template <typename Input> TokenKind scan_char_literal();
+        template <typename Input> TokenKind scan_operator_or_punctuation();
 
         /// Advance past a single escape sequence (after the leading backslash).
-        void skip_escape();
+        template <typename Input> void skip_escape();
 
         // ── Numeric literal helpers ───────────────────────────────────────
-        /// Attempt to consume an exponent group [eE][+-]?\d+.
+        /// Attempt to consume an exponent group [eE][+-]?\d+ and return whether
+        /// one was consumed, its value in `exponent` (saturated at ±1e6).
         /// Uses save/restore: if the exponent is incomplete, restores position
         /// and returns without consuming anything.
-        void try_scan_exponent();
+        template <typename Input> [[nodiscard]] bool try_scan_exponent(std::int64_t &exponent);
 
-        /// Attempt to consume a type suffix (d/D, f/F, u/U[width], i/I<width>).
+        /// Attempt to consume a type suffix (d/D, f/F, u/U[width], i/I<width>),
+        /// recording it in `m_literal.suffix`.
         /// Returns without consuming if no valid suffix is found at current position.
-        void try_scan_type_suffix();
+        template <typename Input> void try_scan_type_suffix();
+
+        /// Fill `m_literal.real` for the decimal literal [m_token_start, end),
+        /// whose digits accumulated to `mantissa` (exact unless
+        /// `m_literal.overflow`) scaled by 10^`exponent`.
+        void decode_decimal_float(std::size_t end, std::uint64_t mantissa, std::int64_t exponent);
+
+        /// Store `m_literal` in the literal table, if any, as the token payload.
+        void record_literal();
+
+        /// Store the literal body [body_start, body_end) in the string table,
+        /// if any, as the token payload.
+        void record_text(std::size_t body_start, std::size_t body_end, bool escaped, bool is_char);
 
         /// Attempt to match and consume a specific integer width suffix starting at
         /// offset 1 from the current position. The `digits` list describes the expected
@@ -130,13 +344,7 @@ namespace jsv {
         /// byte plus all width digits if they match and are not followed by another digit.
         /// Returns true on success, false if the pattern does not match.
         /// Extracted from the `try_width` lambda in try_scan_type_suffix.
-        [[nodiscard]] bool try_scan_width(std::initializer_list<char> digits);
-
-        /// If `c1 == expected`, consumes it, builds a two-character token of `kind`,
-        /// and returns it. Otherwise returns std::nullopt without consuming.
-        /// Extracted from the `two` lambda in scan_operator_or_punctuation.
-        [[nodiscard]] std::optional<Token> try_two_char_token(char c1, char expected, TokenKind kind, std::size_t text_start,
-                                                              const SourceLocation &start);
+        template <typename Input> [[nodiscard]] bool try_scan_width(std::initializer_list<char> digits);
 
         // ── Digit classification (formerly stateless lambdas) ─────────────
         /// Returns true iff `c` is a valid binary digit (0 or 1).
@@ -146,11 +354,62 @@ namespace jsv {
         [[nodiscard]] static constexpr bool is_octal_digit(char c) noexcept;
 
         /// Returns true iff `c` is a valid hexadecimal digit (0–9, a–f, A–F).
-        [[nodiscard]] static bool is_hex_digit(char c) noexcept;
+        [[nodiscard]] static constexpr bool is_hex_digit(char c) noexcept;
 
         // ── Keyword / type classification ─────────────────────────────────
-        /// Map a lexed word to its `TokenKind` (keyword, type, or identifier).
+        /// Map a lexed word to its `TokenKind` (keyword, type, or identifier)
+        /// through the compile-time perfect hash in `Keywords.hpp`.
         [[nodiscard]] static TokenKind classify_word(std::string_view text) noexcept;
     };
 
+    /// Single-pass view returned by `Lexer::tokens()`.
+    ///
+    /// Holds the current token; iterators point back to the range (as with
+    /// `std::ranges::istream_view`), so the range must stay alive and in place
+    /// while it is iterated.
+    class TokenRange : public std::ranges::view_interface<TokenRange> {
+    public:
+        class iterator {
+        public:
+            using iterator_concept = std::input_iterator_tag;
+            using value_type = Token;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() noexcept = default;
+            explicit iterator(TokenRange &range) noexcept : m_range{&range} {}
+
+            [[nodiscard]] const Token &operator*() const noexcept { return *m_range->m_current; }
+            [[nodiscard]] const Token *operator->() const noexcept { return &*m_range->m_current; }
+
+            iterator &operator++() {
+                m_range->advance();
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+
+            [[nodiscard]] friend bool operator==(const iterator &it, std::default_sentinel_t /*sentinel*/) noexcept { return it.at_end(); }
+
+        private:
+            TokenRange *m_range = nullptr;
+
+            [[nodiscard]] bool at_end() const noexcept { return !m_range->m_current.has_value(); }
+        };
+
+        TokenRange() noexcept = default;
+        explicit TokenRange(Lexer &lexer) noexcept;
+
+        /// Lex the first token; call once per range.
+        [[nodiscard]] iterator begin() {
+            advance();
+            return iterator{*this};
+        }
+        [[nodiscard]] std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    private:
+        Lexer *m_lexer = nullptr;
+        std::optional<Token> m_current;  ///< Empty once `Eof` has been passed.
+
+        void advance();
+    };
+
 }  // namespace jsv
\ No newline at end of file
@@ -0,0 +1,93 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "SourceLocation.hpp"
+
+namespace jsv {
+
+    namespace detail {
+
+        /// Byte length of the line terminator starting at `pos`, or 0 if none.
+        /// Recognizes `\n`, NEL (U+0085), LINE SEPARATOR (U+2028) and
+        /// PARAGRAPH SEPARATOR (U+2029).
+        [[nodiscard]] constexpr std::size_t line_terminator_length(const std::string_view text, const std::size_t pos) noexcept {
+            const auto byte = [&text](const std::size_t i) { return i < text.size() ? static_cast<unsigned char>(text[i]) : 0U; };
+            switch(byte(pos)) {
+            case 0x0AU:
+                return 1;
+            case 0xC2U:
+                return byte(pos + 1) == 0x85U ? 2 : 0;
+            case 0xE2U:
+                return byte(pos + 1) == 0x80U && (byte(pos + 2) == 0xA8U || byte(pos + 2) == 0xA9U) ? 3 : 0;
+            default:
+                return 0;
+            }
+        }
+
+    }  // namespace detail
+
+    /// Byte offsets of the start of every line of a source text.
+    ///
+    /// Built once with the block scanner `simd::find_line_break_candidate`, so
+    /// tokens and the lexer only need to carry byte offsets; `resolve` turns an
+    /// offset back into a 1-indexed line and byte-based column on demand.
+    /// Every `\n`, U+0085, U+2028 and U+2029 in the text starts a new line.
+    class LineIndex {
+    public:
+        /// Index of an empty text: a single line starting at offset 0.
+        LineIndex();
+
+        explicit LineIndex(std::string_view text);
+
+        [[nodiscard]] std::size_t line_count() const noexcept { return m_line_starts.size(); }
+
+        /// Offset of the first byte of 1-indexed `line`.
+        [[nodiscard]] std::size_t line_start(const std::size_t line) const noexcept { return m_line_starts[line - 1]; }
+
+        /// Length in bytes of the indexed text.
+        [[nodiscard]] std::size_t text_size() const noexcept { return m_text_size; }
+
+        /// Line/column of `offset` by binary search over the line starts.
+        /// Offsets past the end resolve as the end of the text.
+        [[nodiscard]] SourceLocation resolve(std::size_t offset) const noexcept;
+
+        /// Like `resolve`, but first tries the line in `hint` and the one after
+        /// it, so a caller walking forward through the text resolves in O(1).
+        /// `hint` (a 0-indexed line) is updated to the line of `offset`.
+        [[nodiscard]] SourceLocation resolve(std::size_t offset, std::size_t &hint) const noexcept;
+
+    private:
+        std::vector<std::size_t> m_line_starts;
+        std::size_t m_text_size = 0;
+
+        [[nodiscard]] bool line_contains(std::size_t line, std::size_t offset) const noexcept;
+    };
+
+    /// Line/column of offsets that only move forward, found by scanning the
+    /// text between them: O(1) memory, where a `LineIndex` holds every line
+    /// start. Resolves the same way as `LineIndex`.
+    class LineCursor {
+    public:
+        explicit LineCursor(const std::string_view text) noexcept : m_text{text} {}
+
+        /// True if `offset` is not before the current line, so `resolve` can
+        /// reach it.
+        [[nodiscard]] bool reaches(const std::size_t offset) const noexcept { return offset >= m_line_start; }
+
+        /// Line/column of `offset`. Precondition: `reaches(offset)`.
+        /// Offsets past the end resolve as the end of the text.
+        [[nodiscard]] SourceLocation resolve(std::size_t offset) noexcept;
+
+    private:
+        std::string_view m_text;
+        std::size_t m_scanned = 0;     ///< Every line break before this offset is counted.
+        std::size_t m_line = 1;
+        std::size_t m_line_start = 0;
+    };
+
+}  // namespace jsv
@@ -0,0 +1,79 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "CharClass.hpp"
+#include "Token.hpp"
+
+namespace jsv {
+
+    /// Type suffix of a numeric literal, as accepted by the lexer.
+    enum class NumericSuffix : std::uint8_t { None, F, D, U, U8, U16, U32, I8, I16, I32 };
+
+    /// Value of one numeric literal, decoded while it was scanned.
+    ///
+    /// Integer literals (no `.`, exponent or `f`/`d` suffix, and every `#b`,
+    /// `#o` and `#x` literal) fill `integer`, with `overflow` set when the
+    /// digits do not fit in 64 bits. Decimal floating literals fill `real`,
+    /// correctly rounded to the nearest double.
+    struct NumericLiteral {
+        std::uint64_t integer = 0;
+        double real = 0.0;
+        std::uint8_t base = 10;
+        NumericSuffix suffix = NumericSuffix::None;
+        bool is_float = false;
+        bool overflow = false;
+
+        [[nodiscard]] constexpr bool operator==(const NumericLiteral &other) const noexcept = default;
+    };
+
+    /// Decoded numeric literals of a lexed source, in token order; a numeric
+    /// token's `getLiteral()` indexes into it (see `Lexer::set_literal_table`).
+    class LiteralTable {
+    public:
+        LiteralId add(const NumericLiteral &literal) {
+            m_literals.push_back(literal);
+            return C_UI32T(m_literals.size() - 1);
+        }
+
+        [[nodiscard]] const NumericLiteral &operator[](const LiteralId id) const noexcept { return m_literals[id]; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_literals.size(); }
+        void clear() noexcept { m_literals.clear(); }
+
+    private:
+        std::vector<NumericLiteral> m_literals;
+    };
+
+    namespace detail {
+
+        /// `value * base + digit`, setting `overflow` instead of wrapping.
+        [[nodiscard]] constexpr std::uint64_t accumulate_digit(const std::uint64_t value, const unsigned base, const unsigned digit,
+                                                               bool &overflow) noexcept {
+            if(value > (std::numeric_limits<std::uint64_t>::max() - digit) / base) {
+                overflow = true;
+                return value;
+            }
+            return value * base + digit;
+        }
+
+        /// Clinger's fast path: `mantissa * 10^exponent` is exact in one
+        /// rounding when the mantissa fits in 53 bits and |exponent| <= 22
+        /// (10^22 is the largest exactly representable power of ten).
+        /// Returns false when the fast path does not apply.
+        [[nodiscard]] constexpr bool decimal_to_double_fast(const std::uint64_t mantissa, const std::int64_t exponent,
+                                                            double &out) noexcept {
+            constexpr std::array<double, 23> powers{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+            if(mantissa > (std::uint64_t{1} << 53U) || exponent < -22 || exponent > 22) { return false; }
+            const auto value = C_D(mantissa);
+            out = exponent < 0 ? value / powers[C_ST(-exponent)] : value * powers[C_ST(exponent)];
+            return true;
+        }
+
+    }  // namespace detail
+
+}  // namespace jsv
@@ -0,0 +1,153 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
+
+#pragma once
+
+#include "CharClass.hpp"
+#include "Token.hpp"
+
+namespace jsv {
+
+    /// One operator or punctuation spelling and the token kind it lexes to.
+    struct OperatorEntry {
+        std::string_view text;
+        TokenKind kind;
+    };
+
+    /// Every operator and punctuation token, one or two bytes long.
+    /// Adding an entry here is all that is needed: the trie below is rebuilt
+    /// at compile time, and `static_assert`s reject duplicates and first
+    /// bytes missing from `CharClass::OperatorStart`.
+    inline constexpr std::array<OperatorEntry, 36> operator_list{{
+        {"+", TokenKind::Plus},
+        {"+=", TokenKind::PlusEqual},
+        {"++", TokenKind::PlusPlus},
+        {"-", TokenKind::Minus},
+        {"-=", TokenKind::MinusEqual},
+        {"--", TokenKind::MinusMinus},
+        {"=", TokenKind::Equal},
+        {"==", TokenKind::EqualEqual},
+        {"!", TokenKind::Not},
+        {"!=", TokenKind::NotEqual},
+        {"<", TokenKind::Less},
+        {"<=", TokenKind::LessEqual},
+        {"<<", TokenKind::ShiftLeft},
+        {">", TokenKind::Greater},
+        {">=", TokenKind::GreaterEqual},
+        {">>", TokenKind::ShiftRight},
+        {"|", TokenKind::Or},
+        {"||", TokenKind::OrOr},
+        {"&", TokenKind::And},
+        {"&&", TokenKind::AndAnd},
+        {"%", TokenKind::Percent},
+        {"%=", TokenKind::PercentEqual},
+        {"^", TokenKind::Xor},
+        {"^=", TokenKind::XorEqual},
+        {"*", TokenKind::Star},
+        {"/", TokenKind::Slash},
+        {":", TokenKind::Colon},
+        {",", TokenKind::Comma},
+        {".", TokenKind::Dot},
+        {";", TokenKind::Semicolon},
+        {"(", TokenKind::OpenParen},
+        {")", TokenKind::CloseParen},
+        {"[", TokenKind::OpenBracket},
+        {"]", TokenKind::CloseBracket},
+        {"{", TokenKind::OpenBrace},
+        {"}", TokenKind::CloseBrace},
+    }};
+
+    /// Longest operator at a position: its kind and length, 0 when none.
+    struct OperatorMatch {
+        TokenKind kind = TokenKind::Error;
+        std::uint8_t length = 0;
+    };
+
+    namespace detail {
+
+        inline constexpr std::uint8_t no_operator_row = 0xFF;
+
+        /// Trie root entry for one first byte. `row` names its row of second
+        /// bytes in `operator_rows`, or is `no_operator_row` when no
+        /// two-byte operator starts with it.
+        struct OperatorRoot {
+            TokenKind single = TokenKind::Error;  ///< One-byte operator, or `Error`.
+            std::uint8_t row = no_operator_row;
+        };
+
+        [[nodiscard]] consteval std::size_t count_operator_rows() noexcept {
+            std::array<bool, 256> has_row{};
+            std::size_t rows = 0;
+            for(const auto &entry : operator_list) {
+                const auto first = static_cast<unsigned char>(entry.text[0]);
+                if(entry.text.size() == 2 && !has_row[first]) {
+                    has_row[first] = true;
+                    ++rows;
+                }
+            }
+            return rows;
+        }
+
+        inline constexpr std::size_t operator_row_count = count_operator_rows();
+        static_assert(operator_row_count < no_operator_row, "too many operator rows for an 8-bit index");
+
+        [[nodiscard]] consteval std::array<OperatorRoot, 256> build_operator_roots() noexcept {
+            std::array<OperatorRoot, 256> roots{};
+            std::uint8_t next_row = 0;
+            for(const auto &entry : operator_list) {
+                auto &root = roots[static_cast<unsigned char>(entry.text[0])];
+                if(entry.text.size() == 1) { root.single = entry.kind; }
+                if(entry.text.size() == 2 && root.row == no_operator_row) { root.row = next_row++; }
+            }
+            return roots;
+        }
+
+        inline constexpr std::array<OperatorRoot, 256> operator_roots = build_operator_roots();
+
+        /// Second level: `operator_rows[row][second]` is the two-byte operator
+        /// kind, or `Error`. Full 256-byte rows make the lookup branch-free.
+        [[nodiscard]] consteval std::array<std::array<TokenKind, 256>, operator_row_count> build_operator_rows() noexcept {
+            std::array<std::array<TokenKind, 256>, operator_row_count> rows{};
+            for(auto &row : rows) { row.fill(TokenKind::Error); }
+            for(const auto &entry : operator_list) {
+                if(entry.text.size() != 2) { continue; }
+                rows[operator_roots[static_cast<unsigned char>(entry.text[0])].row][static_cast<unsigned char>(entry.text[1])] = entry.kind;
+            }
+            return rows;
+        }
+
+        inline constexpr std::array<std::array<TokenKind, 256>, operator_row_count> operator_rows = build_operator_rows();
+
+        static_assert(
+            [] {
+                for(std::size_t i = 0; i < operator_list.size(); ++i) {
+                    const auto &entry = operator_list[i];
+                    if(entry.text.empty() || entry.text.size() > 2 || !has_char_class(entry.text[0], CharClass::OperatorStart)) { return false; }
+                    for(std::size_t j = 0; j < i; ++j) {
+                        if(operator_list[j].text == entry.text) { return false; }
+                    }
+                }
+                return true;
+            }(),
+            "operator_list: every entry must be 1-2 bytes, unique, and start with a CharClass::OperatorStart byte");
+
+    }  // namespace detail
+
+    /// Longest operator spelled by `first` followed by `second` (pass '\0'
+    /// past the end of input). One table load for the first byte and, when a
+    /// two-byte operator may follow, one for the second — no byte compares.
+    [[nodiscard]] constexpr OperatorMatch match_operator(const char first, const char second) noexcept {
+        const auto root = detail::operator_roots[static_cast<unsigned char>(first)];
+        if(root.row != detail::no_operator_row) {
+            if(const auto kind = detail::operator_rows[root.row][static_cast<unsigned char>(second)]; kind != TokenKind::Error) { return {kind, 2}; }
+        }
+        if(root.single != TokenKind::Error) { return {root.single, 1}; }
+        return {};
+    }
+
+}  // namespace jsv
+
+// NOLINTEND(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-constant-array-index)
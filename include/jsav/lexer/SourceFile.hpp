@@ -0,0 +1,95 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "CompactToken.hpp"
+#include "LineIndex.hpp"
+
+namespace jsv {
+
+    class TokenView;
+
+    /// A lexed source as seen by `CompactToken`s: the text, its path and its id.
+    ///
+    /// The text is a non-owning view — like `Lexer`, the caller (usually a
+    /// `SourceManager`) keeps the buffer alive. Token text, line and column
+    /// are recovered on demand from it; the `LineIndex` is built once at
+    /// construction.
+    class SourceFile {
+    public:
+        SourceFile(std::string_view text, std::string path, FileId id = 0);
+
+        [[nodiscard]] std::string_view text() const noexcept { return m_text; }
+        [[nodiscard]] std::string_view path() const noexcept { return m_path; }
+        [[nodiscard]] FileId id() const noexcept { return m_id; }
+        [[nodiscard]] const LineIndex &lines() const noexcept { return m_lines; }
+
+        /// Source slice covered by `token`; empty for a token of another file.
+        [[nodiscard]] std::string_view text_of(const CompactToken &token) const noexcept;
+
+        /// Line/column of byte `offset` (binary search in the line index).
+        [[nodiscard]] SourceLocation location(std::size_t offset) const noexcept;
+
+        /// Span of `token`, start inclusive and end exclusive.
+        [[nodiscard]] SourceSpan span_of(const CompactToken &token) const noexcept;
+
+        /// Rebuild the full `Token` (text view + span) for `token`.
+        [[nodiscard]] Token materialize(const CompactToken &token) const noexcept;
+
+        /// Bind `token` to this source for accessor-style use and formatting.
+        [[nodiscard]] TokenView view(const CompactToken &token) const noexcept;
+
+    private:
+        std::string_view m_text;
+        std::string m_path;
+        FileId m_id;
+        LineIndex m_lines;
+    };
+
+    /// `Token`-like accessors over a `CompactToken` and the `SourceFile` it
+    /// came from. Holds the token by value, so a view of a token returned by
+    /// value (e.g. from `TokenStream`) stays usable; valid while the source is.
+    class TokenView {
+    public:
+        TokenView(const CompactToken &token, const SourceFile &source) noexcept : m_token{token}, m_source{&source} {}
+
+        [[nodiscard]] TokenKind getKind() const noexcept { return m_token.getKind(); }
+        [[nodiscard]] std::string_view getText() const noexcept { return m_source->text_of(m_token); }
+        [[nodiscard]] SourceSpan getSpan() const noexcept { return m_source->span_of(m_token); }
+        [[nodiscard]] const CompactToken &getToken() const noexcept { return m_token; }
+
+        /// Same format as `Token::to_string(path)`, with this source's path.
+        [[nodiscard]] std::string to_string() const;
+
+        friend std::ostream &operator<<(std::ostream &os, const TokenView &token);
+
+    private:
+        CompactToken m_token;
+        const SourceFile *m_source;
+    };
+
+}  // namespace jsv
+
+// -------------------------------------------------------------------------
+// std::formatter  (C++23 <format>)
+// -------------------------------------------------------------------------
+namespace std {
+    template <> struct formatter<jsv::TokenView> : formatter<string> {
+        template <typename FormatContext> auto format(const jsv::TokenView &token, FormatContext &ctx) const {
+            return formatter<string>::format(token.to_string(), ctx);
+        }
+    };
+}  // namespace std
+
+// -------------------------------------------------------------------------
+// fmt::formatter  (fmtlib)
+// -------------------------------------------------------------------------
+template <> struct fmt::formatter<jsv::TokenView> : fmt::formatter<std::string> {
+    template <typename FormatContext> auto format(const jsv::TokenView &token, FormatContext &ctx) const {
+        return fmt::formatter<std::string>::format(token.to_string(), ctx);
+    }
+};
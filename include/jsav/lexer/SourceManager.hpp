@@ -0,0 +1,89 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "SourceFile.hpp"
+#include <deque>
+#include <unordered_map>
+
+namespace jsv {
+
+    /// Owner of every loaded source, addressed by `FileId`.
+    ///
+    /// Each source keeps its `vnd::SourceBuffer` (mapped or padded, so lexers
+    /// built from it run in sentinel mode), its path and a `SourceFile` for
+    /// line lookups. Spans carry only the id; paths and positions are resolved
+    /// here. Every path gets its own id; sources with identical content share
+    /// one buffer. Adding the same path with the same bytes again returns its
+    /// existing id.
+    ///
+    /// References returned by `file` stay valid while the manager lives, even
+    /// as more sources are added. Not thread-safe.
+    class SourceManager {
+    public:
+        SourceManager() = default;
+        SourceManager(const SourceManager &) = delete;
+        SourceManager &operator=(const SourceManager &) = delete;
+        SourceManager(SourceManager &&) = default;
+        SourceManager &operator=(SourceManager &&) = default;
+        ~SourceManager() = default;
+
+        /// Load the file at `path` through `vnd::SourceBuffer::from_file`.
+        /// @throws FileReadError if it cannot be read.
+        /// @throws std::length_error past `max_files` sources.
+        FileId load(std::string_view path);
+
+        /// Read `paths` concurrently (see `vnd::SourceBuffer::from_files`),
+        /// then add them in order. One result per path: its id, or why it
+        /// could not be read.
+        /// @throws std::length_error past `max_files` sources.
+        std::vector<std::expected<FileId, FileReadError>> load_all(std::span<const std::string> paths, std::size_t threads = 0);
+
+        /// Take ownership of `buffer`, naming it `path` in diagnostics.
+        /// @throws std::length_error past `max_files` sources.
+        FileId add(std::string path, vnd::SourceBuffer buffer);
+
+        /// Add a padded copy of `text`, named `path` in diagnostics.
+        FileId add(std::string path, std::string_view text) { return add(vnd_move(path), vnd::SourceBuffer::copy_of(text)); }
+
+        [[nodiscard]] const SourceFile &file(const FileId id) const noexcept { return m_entries[id].file; }
+        [[nodiscard]] const vnd::SourceBuffer &buffer(const FileId id) const noexcept { return *m_entries[id].buffer; }
+        [[nodiscard]] std::string_view path(const FileId id) const noexcept { return file(id).path(); }
+        [[nodiscard]] std::string_view text(const FileId id) const noexcept { return file(id).text(); }
+
+        /// Line/column of byte `offset` in source `id`.
+        [[nodiscard]] SourceLocation location(const FileId id, const std::size_t offset) const noexcept { return file(id).location(offset); }
+
+        /// `span` formatted with its file's path (see `SourceSpan::to_string`).
+        [[nodiscard]] std::string to_string(const SourceSpan &span) const { return span.to_string(path(span.file_id)); }
+        /// `token` formatted with its file's path (see `Token::to_string`).
+        [[nodiscard]] std::string to_string(const Token &token) const { return token.to_string(path(token.getSpan().file_id)); }
+
+        /// Number of sources.
+        [[nodiscard]] std::size_t size() const noexcept { return m_entries.size(); }
+        /// Number of sources sharing the buffer of an earlier one.
+        [[nodiscard]] std::size_t duplicates() const noexcept { return m_duplicates; }
+
+        /// Largest number of sources; `FileId` is 16 bits wide.
+        static constexpr std::size_t max_files = std::size_t{std::numeric_limits<FileId>::max()} + 1;
+
+    private:
+        struct Entry {
+            Entry(std::shared_ptr<const vnd::SourceBuffer> p_buffer, std::string path, FileId id)
+              : buffer{vnd_move(p_buffer)}, file{buffer->text(), vnd_move(path), id} {}
+
+            std::shared_ptr<const vnd::SourceBuffer> buffer;  ///< Shared by sources with the same bytes.
+            SourceFile file;
+        };
+
+        std::deque<Entry> m_entries;
+        std::unordered_multimap<std::size_t, FileId> m_by_hash;  ///< Content hash → first id holding those bytes.
+        std::unordered_map<std::string, FileId> m_by_path;       ///< Path → its latest id.
+        std::size_t m_duplicates = 0;
+    };
+
+}  // namespace jsv
@@ -10,18 +10,22 @@
 
 namespace jsv {
 
+    /// Small integer naming a source, handed out by `SourceManager`.
+    using FileId = std::uint16_t;
+
     /// Represents a contiguous range of source code in a specific file.
     ///
     /// Spans track:
-    /// - Source file path
+    /// - Source file id (resolved to a path by `SourceManager`)
     /// - Start position (inclusive)
     /// - End position (exclusive)
     ///
     /// Used for error reporting, source mapping, and semantic analysis.
+    /// Comparison and hashing look at integers only.
     class SourceSpan {
     public:
-        /// Path to source file (shared, immutable — mirrors Rust's Arc<str>)
-        std::string_view file_path;
+        /// Id of the source file; see `SourceManager::path`.
+        FileId file_id = 0;
 
         /// Starting position of the span (inclusive)
         SourceLocation start;
@@ -29,33 +33,45 @@ namespace jsv {
         /// Ending position of the span (exclusive)
         SourceLocation end;
 
-        /// Default constructor — empty path, zero positions.
+        /// Default constructor — file 0, zero positions.
         constexpr SourceSpan() noexcept = default;
 
         /// Creates a new source span covering a specific range.
         ///
-        /// @param p_file_path Shared pointer to source file path string
-        /// @param p_start      Starting position (inclusive)
-        /// @param p_end        Ending position (exclusive)
-        constexpr SourceSpan(std::string_view p_file_path, const SourceLocation &p_start, const SourceLocation &p_end) noexcept
-          : file_path{p_file_path}, start{p_start}, end{p_end} {}
+        /// @param p_file_id Id of the source file
+        /// @param p_start   Starting position (inclusive)
+        /// @param p_end     Ending position (exclusive)
+        constexpr SourceSpan(const FileId p_file_id, const SourceLocation &p_start, const SourceLocation &p_end) noexcept
+          : file_id{p_file_id}, start{p_start}, end{p_end} {}
 
         /// Merges another span into this one in-place.
         /// Only merges if spans are from the same file.
-        void merge(const SourceSpan &other) noexcept;
+        constexpr void merge(const SourceSpan &other) noexcept {
+            if(file_id == other.file_id) {
+                if(other.start < start) { start = other.start; }
+                if(other.end > end) { end = other.end; }
+            }
+        }
 
         /// Creates a new span that combines this span with another.
         /// Returns std::nullopt if spans are from different files.
-        [[nodiscard]] std::optional<SourceSpan> merged(const SourceSpan &other) const;
+        [[nodiscard]] constexpr std::optional<SourceSpan> merged(const SourceSpan &other) const noexcept {
+            if(file_id != other.file_id) { return std::nullopt; }
+            return SourceSpan{file_id, (start < other.start) ? start : other.start, (end > other.end) ? end : other.end};
+        }
 
-        /// Lexicographic ordering: file_path (by value) → start → end.
-        [[nodiscard]] std::strong_ordering operator<=>(const SourceSpan &other) const noexcept;
-        [[nodiscard]] bool operator==(const SourceSpan &other) const noexcept;
+        /// Lexicographic ordering: file_id → start → end.
+        [[nodiscard]] constexpr std::strong_ordering operator<=>(const SourceSpan &other) const noexcept = default;
+        [[nodiscard]] constexpr bool operator==(const SourceSpan &other) const noexcept = default;
 
-        /// Format: `[truncated_path]:line [sl]:column [sc] - line [el]:column [ec]`
-        /// Shared by operator<<, std::formatter and fmt::formatter.
+        /// Format: `<file [id]>:line [sl]:column [sc] - line [el]:column [ec]`
+        /// Shared by operator<<, std::formatter and fmt::formatter. Use
+        /// `to_string(path)` or `SourceManager::to_string` to show the path.
         [[nodiscard]] std::string to_string() const;
 
+        /// Format: `[truncated_path]:line [sl]:column [sc] - line [el]:column [ec]`
+        [[nodiscard]] std::string to_string(std::string_view path) const;
+
         friend std::ostream &operator<<(std::ostream &os, const SourceSpan &span);
     };
 
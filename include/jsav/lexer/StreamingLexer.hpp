@@ -0,0 +1,125 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "Lexer.hpp"
+#include <functional>
+#include <istream>
+
+namespace jsv {
+
+    /// Tuning for `StreamingLexer`.
+    struct StreamLexOptions {
+        /// Bytes read from the input per refill.
+        std::size_t window_bytes = std::size_t{4} << 20U;
+        /// Longest token accepted. Comments and whitespace are not tokens and
+        /// may be of any length.
+        std::size_t max_token_bytes = std::size_t{1} << 20U;
+    };
+
+    /// One token of a `StreamingLexer`, located by absolute byte offset.
+    struct StreamToken {
+        TokenKind kind = TokenKind::Eof;
+        std::uint64_t offset = 0;  ///< From the start of the stream (BOM included).
+        std::uint32_t length = 0;
+        /// `SymbolId` or `LiteralId` by kind, when the matching table is set.
+        std::uint32_t payload = no_symbol;
+        /// Token text in the window; valid until the next call to `next`.
+        std::string_view text;
+    };
+
+    /// Lexer front end for inputs of any size, read from a file descriptor or
+    /// stream in fixed-size windows.
+    ///
+    /// Memory stays bounded by `window_bytes + max_token_bytes` plus a few
+    /// bytes of lookahead and the `vnd::SourceBuffer::padding`, however large
+    /// the input. Each window is lexed in place by a `Lexer` in sentinel mode;
+    /// a token, or its lookahead, that runs into the end of the window is
+    /// re-lexed once the next window is read, so tokens cut by a boundary —
+    /// split UTF-8 sequences included — come out as if the input had been
+    /// lexed whole. Comments are skipped here instead, carrying their state
+    /// across windows, so a block comment longer than the window costs no
+    /// memory.
+    ///
+    /// Produces the same kinds, offsets and lengths as `Lexer::tokenize_compact`
+    /// over the whole input. There are no line/column positions, and no string
+    /// table: its entries would view the window.
+    class StreamingLexer {
+    public:
+        /// Reads up to `size` bytes into `buffer`, returning 0 at end of input.
+        /// A short read is lexed at once, before reading on (see `vnd::ReadAhead`).
+        using Reader = std::function<std::size_t(char *buffer, std::size_t size)>;
+
+        /// @param read Input source; see `Reader`.
+        /// @param name Input name used in diagnostics.
+        explicit StreamingLexer(Reader read, std::string name, const StreamLexOptions &options = {});
+
+        /// Lex `input` from its current position.
+        /// @throws FileReadError if the stream goes bad while reading.
+        explicit StreamingLexer(std::istream &input, std::string name, const StreamLexOptions &options = {});
+
+#ifndef _WIN32
+        /// Lex the file descriptor `fd` (not owned) from its current position.
+        /// @throws FileReadError if a read fails.
+        explicit StreamingLexer(int fd, std::string name, const StreamLexOptions &options = {});
+#endif
+
+        StreamingLexer(const StreamingLexer &) = delete;
+        StreamingLexer &operator=(const StreamingLexer &) = delete;
+        StreamingLexer(StreamingLexer &&) = delete;
+        StreamingLexer &operator=(StreamingLexer &&) = delete;
+        ~StreamingLexer() = default;
+
+        /// Next token; `Eof` at the end of input, and on every call after.
+        /// @throws std::length_error for a token longer than `max_token_bytes`.
+        [[nodiscard]] StreamToken next();
+
+        /// Intern identifiers into `interner`, as `Lexer::set_interner`.
+        void set_interner(Interner *interner) noexcept { m_tables.interner = interner; }
+        /// Decode numeric literals into `literals`, as `Lexer::set_literal_table`.
+        void set_literal_table(LiteralTable *literals) noexcept { m_tables.literals = literals; }
+
+        /// Bytes read from the input so far.
+        [[nodiscard]] std::uint64_t bytes_read() const noexcept { return m_base + m_end; }
+        /// Size of the window buffer, fixed at construction.
+        [[nodiscard]] std::size_t buffer_capacity() const noexcept { return m_capacity; }
+
+    private:
+        /// Comment left open at the end of the window.
+        enum class OpenComment : std::uint8_t { None, Line, Block };
+
+        Reader m_read;
+        std::string m_name;
+        StreamLexOptions m_options;
+        std::size_t m_capacity;  ///< Text bytes the buffer holds, padding excluded.
+        std::unique_ptr<char[]> m_buffer;  // NOLINT(*-avoid-c-arrays)
+        std::uint64_t m_base = 0;  ///< Stream offset of `m_buffer[0]`.
+        std::size_t m_pos = 0;     ///< Next unlexed byte in the buffer.
+        std::size_t m_end = 0;     ///< Bytes of text in the buffer.
+        bool m_eof = false;        ///< The reader has returned 0.
+        bool m_started = false;    ///< The first window (and its BOM) has been read.
+        OpenComment m_comment = OpenComment::None;
+        LexTables m_tables;
+        std::optional<Lexer> m_window;  ///< Lexer over [0, m_end), rebuilt by `refill`.
+
+        /// Drop the bytes before `m_pos`, then read until the buffer is full,
+        /// a read comes back short or the input ends, and rebuild `m_window`.
+        void refill();
+
+        /// True when fewer than `bytes` bytes from `m_pos` are loaded and
+        /// more may come: the caller must `refill` before deciding.
+        [[nodiscard]] bool short_of(std::size_t bytes) const noexcept { return !m_eof && m_end - m_pos < bytes; }
+
+        /// Skip whitespace and comments, reading windows as needed. Returns
+        /// with `m_pos` at the first byte of a token, or at the end of input.
+        void skip_trivia();
+
+        /// Scan the token at `m_pos` with `m_window`, filling side tables only
+        /// when `with_tables`.
+        [[nodiscard]] TokenKind scan(bool with_tables);
+    };
+
+}  // namespace jsv
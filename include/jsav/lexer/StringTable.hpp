@@ -0,0 +1,120 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "Arena.hpp"
+#include "CharClass.hpp"
+#include "Token.hpp"
+#include "unicode/Utf8.hpp"
+
+namespace jsv {
+
+    /// Decoded value of one string or char literal.
+    struct TextLiteral {
+        /// Body without the quotes, escapes decoded. A view into the source
+        /// when the literal has no backslash, into the table's arena otherwise.
+        std::string_view value;
+        char32_t codepoint = 0;  ///< Char literals: the character (0 when empty or invalid).
+        bool escaped = false;    ///< The body had at least one escape.
+        bool valid = true;       ///< Every escape was well formed (kept raw otherwise).
+    };
+
+    namespace detail {
+
+        /// Byte of a one-character escape (`\n \t \r \0 \\ \" \'`), by the
+        /// character after the backslash.
+        [[nodiscard]] constexpr std::optional<char> simple_escape(const char tag) noexcept {
+            switch(tag) {
+            case 'n':
+                return '\n';
+            case 't':
+                return '\t';
+            case 'r':
+                return '\r';
+            case '0':
+                return '\0';
+            case '\\':
+            case '"':
+            case '\'':
+                return tag;
+            default:
+                return std::nullopt;
+            }
+        }
+
+        /// Scalar value of the hex digits of a `\u`/`\U` escape, if well formed.
+        [[nodiscard]] constexpr std::optional<char32_t> hex_escape(const std::string_view digits) noexcept {
+            std::uint32_t value = 0;
+            for(const char c : digits) {
+                if(!is_ascii_hex_digit(c)) { return std::nullopt; }
+                value = value * 16 + hex_digit_value(c);
+            }
+            if(value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) { return std::nullopt; }
+            return C_C32(value);
+        }
+
+        /// Decode the escapes of `body` into `out`, which needs `body.size()`
+        /// bytes: no escape decodes to more bytes than it is written with.
+        /// Any escape other than the simple ones, `\uXXXX` and `\UXXXXXXXX` —
+        /// or one with short digits or a non-scalar value — is copied as
+        /// written and clears `valid`. Returns the decoded length.
+        [[nodiscard]] constexpr std::size_t unescape(const std::string_view body, char *out, bool &valid) noexcept {
+            std::size_t written = 0;
+            std::size_t i = 0;
+            while(i < body.size()) {
+                if(body[i] != '\\') {
+                    out[written++] = body[i++];
+                    continue;
+                }
+                const char tag = i + 1 < body.size() ? body[i + 1] : '\\';
+                if(const auto byte = simple_escape(tag); byte && i + 1 < body.size()) {
+                    out[written++] = *byte;
+                    i += 2;
+                    continue;
+                }
+                if(const std::size_t digits = tag == 'u' ? 4 : tag == 'U' ? 8 : 0; digits != 0 && i + 2 + digits <= body.size()) {
+                    if(const auto cp = hex_escape(body.substr(i + 2, digits))) {
+                        written += unicode::encode_utf8(*cp, out + written);
+                        i += 2 + digits;
+                        continue;
+                    }
+                }
+                // Unknown or malformed: keep the backslash; what follows is copied as plain text.
+                valid = false;
+                out[written++] = body[i++];
+            }
+            return written;
+        }
+
+    }  // namespace detail
+
+    /// Decoded string and char literals of a lexed source, in token order; a
+    /// literal token's `getString()` indexes into it (see `Lexer::set_string_table`).
+    ///
+    /// A body without backslash — which the lexer knows from the scan — is
+    /// kept as a view of the source, without copying. Escaped bodies are
+    /// decoded once into a bump `Arena`, so no literal allocates on its own.
+    class StringTable {
+    public:
+        /// Add the body of a string literal (between the quotes).
+        StringId add_string(std::string_view body, bool escaped);
+
+        /// Add the body of a char literal and decode its character.
+        StringId add_char(std::string_view body, bool escaped);
+
+        [[nodiscard]] const TextLiteral &operator[](const StringId id) const noexcept { return m_literals[id]; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_literals.size(); }
+        [[nodiscard]] const Arena &arena() const noexcept { return m_arena; }
+
+    private:
+        std::vector<TextLiteral> m_literals;
+        Arena m_arena;
+
+        [[nodiscard]] TextLiteral decode(std::string_view body, bool escaped);
+    };
+
+}  // namespace jsv
@@ -273,10 +273,45 @@ namespace jsv {
         }
     }
 
+    /// Dense id of an interned identifier name (see `Interner`).
+    using SymbolId = std::uint32_t;
+
+    /// Symbol of tokens that are not identifiers, or lexed without an interner.
+    inline constexpr SymbolId no_symbol = std::numeric_limits<SymbolId>::max();
+
+    /// Index of a decoded numeric literal in a `LiteralTable`.
+    using LiteralId = std::uint32_t;
+
+    /// Literal of tokens that are not numeric, or lexed without a literal table.
+    inline constexpr LiteralId no_literal = std::numeric_limits<LiteralId>::max();
+
+    /// Index of a decoded string or char literal in a `StringTable`.
+    using StringId = std::uint32_t;
+
+    /// String of tokens that are not string/char literals, or lexed without a string table.
+    inline constexpr StringId no_string = std::numeric_limits<StringId>::max();
+
+    /// True for ASCII and Unicode identifiers (keywords excluded).
+    [[nodiscard]] constexpr bool isIdentifier(const TokenKind kind) noexcept {
+        return kind == TokenKind::IdentifierAscii || kind == TokenKind::IdentifierUnicode;
+    }
+
+    /// True for decimal and `#b`/`#o`/`#x` numeric literals.
+    [[nodiscard]] constexpr bool isNumericLiteral(const TokenKind kind) noexcept {
+        return kind == TokenKind::Numeric || kind == TokenKind::Binary || kind == TokenKind::Octal || kind == TokenKind::Hexadecimal;
+    }
+
+    /// True for string and char literals.
+    [[nodiscard]] constexpr bool isTextLiteral(const TokenKind kind) noexcept {
+        return kind == TokenKind::StringLiteral || kind == TokenKind::CharLiteral;
+    }
+
     class Token {
     public:
         // Costruttore primario
-        Token(const TokenKind kind, std::string_view text, const SourceSpan &span) : m_kind(kind), m_text(text), m_span(span) {}
+        // `payload` is the SymbolId, LiteralId or StringId matching `kind`
+        Token(const TokenKind kind, std::string_view text, const SourceSpan &span, const std::uint32_t payload = no_symbol)
+          : m_kind(kind), m_text(text), m_span(span), m_payload(payload) {}
 
         Token(const Token &other) noexcept = default;
         Token &operator=(const Token &other) noexcept = default;
@@ -287,8 +322,14 @@ namespace jsv {
         [[nodiscard]] TokenKind getKind() const { return m_kind; }
         [[nodiscard]] std::string_view getText() const { return m_text; }
         [[nodiscard]] const SourceSpan &getSpan() const { return m_span; }
+        [[nodiscard]] SymbolId getSymbol() const { return isIdentifier(m_kind) ? m_payload : no_symbol; }
+        [[nodiscard]] LiteralId getLiteral() const { return isNumericLiteral(m_kind) ? m_payload : no_literal; }
+        [[nodiscard]] StringId getString() const { return isTextLiteral(m_kind) ? m_payload : no_string; }
+        [[nodiscard]] std::uint32_t getPayload() const { return m_payload; }
 
         [[nodiscard]] std::string to_string() const;
+        /// As `to_string`, with the span showing `path` instead of the file id.
+        [[nodiscard]] std::string to_string(std::string_view path) const;
 
         friend std::ostream &operator<<(std::ostream &os, const Token &token);
 
@@ -296,6 +337,7 @@ namespace jsv {
         TokenKind m_kind;
         std::string_view m_text;  // testo originale del token (senza modifiche)
         SourceSpan m_span;        // posizione del token nel codice sorgente
+        std::uint32_t m_payload;  // SymbolId, LiteralId o StringId a seconda del tipo
     };
 
 }  // namespace jsv
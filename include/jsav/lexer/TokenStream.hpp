@@ -0,0 +1,140 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+
+#pragma once
+
+#include "../headers.hpp"
+#include "CompactToken.hpp"
+#include <span>
+
+namespace jsv {
+
+    /// Structure-of-arrays token container filled by `Lexer::tokenize_into`.
+    ///
+    /// Kinds, offsets, lengths and payloads (symbol, literal or string ids)
+    /// live in four separate contiguous arrays (13 bytes per token), so a pass
+    /// that only looks at kinds touches one byte per token. Iteration yields
+    /// `CompactToken` values rebuilt from the arrays; text and spans come from
+    /// a `SourceFile` as usual.
+    ///
+    /// `clear()` keeps the capacity, so one stream can be reused across files
+    /// without reallocating; `shrink_to_fit()` releases the slack.
+    class TokenStream {
+    public:
+        class const_iterator;
+
+        TokenStream() = default;
+
+        [[nodiscard]] std::size_t size() const noexcept { return m_kinds.size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_kinds.empty(); }
+        [[nodiscard]] std::size_t capacity() const noexcept { return m_kinds.capacity(); }
+
+        /// File id stamped on every token yielded by this stream.
+        [[nodiscard]] FileId file_id() const noexcept { return m_file_id; }
+        void set_file_id(const FileId file_id) noexcept { m_file_id = file_id; }
+
+        [[nodiscard]] std::span<const TokenKind> kinds() const noexcept { return m_kinds; }
+        [[nodiscard]] std::span<const std::uint32_t> offsets() const noexcept { return m_offsets; }
+        [[nodiscard]] std::span<const std::uint32_t> lengths() const noexcept { return m_lengths; }
+        /// `SymbolId`, `LiteralId` or `StringId` by token kind (see `CompactToken`).
+        [[nodiscard]] std::span<const std::uint32_t> payloads() const noexcept { return m_payloads; }
+
+        [[nodiscard]] CompactToken operator[](const std::size_t index) const noexcept {
+            return CompactToken{m_kinds[index], m_offsets[index], m_lengths[index], m_file_id, m_payloads[index]};
+        }
+
+        void push_back(TokenKind kind, std::uint32_t offset, std::uint32_t length, std::uint32_t payload = no_symbol);
+        void push_back(const CompactToken &token) { push_back(token.getKind(), token.getOffset(), token.getLength(), token.getPayload()); }
+
+        void set_payload(const std::size_t index, const std::uint32_t payload) noexcept { m_payloads[index] = payload; }
+
+        /// Append the tokens of `other` from index `first` on (file id is not copied).
+        void append(const TokenStream &other, std::size_t first = 0);
+
+        [[nodiscard]] CompactToken back() const noexcept { return (*this)[size() - 1]; }
+
+        /// Replace tokens [first, last) with the tokens of `with`.
+        void replace(std::size_t first, std::size_t last, const TokenStream &with);
+
+        /// Add `delta` (which may be negative) to the offset of every token from `first` on.
+        void shift_offsets(std::size_t first, std::int64_t delta) noexcept;
+
+        void reserve(std::size_t count);
+
+        /// Remove every token; capacity is kept for the next file.
+        void clear() noexcept;
+
+        /// Release unused capacity in every array.
+        void shrink_to_fit();
+
+        [[nodiscard]] const_iterator begin() const noexcept;
+        [[nodiscard]] const_iterator end() const noexcept;
+
+    private:
+        std::vector<TokenKind> m_kinds;
+        std::vector<std::uint32_t> m_offsets;
+        std::vector<std::uint32_t> m_lengths;
+        std::vector<std::uint32_t> m_payloads;
+        FileId m_file_id = 0;
+    };
+
+    /// Random-access iterator yielding `CompactToken` by value.
+    class TokenStream::const_iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CompactToken;
+        using difference_type = std::ptrdiff_t;
+        using reference = CompactToken;
+
+        const_iterator() noexcept = default;
+        const_iterator(const TokenStream *stream, const std::size_t index) noexcept : m_stream{stream}, m_index{index} {}
+
+        [[nodiscard]] CompactToken operator*() const noexcept { return (*m_stream)[m_index]; }
+        [[nodiscard]] CompactToken operator[](const difference_type n) const noexcept { return *(*this + n); }
+
+        const_iterator &operator++() noexcept {
+            ++m_index;
+            return *this;
+        }
+        const_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++m_index;
+            return tmp;
+        }
+        const_iterator &operator--() noexcept {
+            --m_index;
+            return *this;
+        }
+        const_iterator operator--(int) noexcept {
+            auto tmp = *this;
+            --m_index;
+            return tmp;
+        }
+        const_iterator &operator+=(const difference_type n) noexcept {
+            m_index = C_ST(C_PTRDIFT(m_index) + n);
+            return *this;
+        }
+        const_iterator &operator-=(const difference_type n) noexcept { return *this += -n; }
+
+        [[nodiscard]] friend const_iterator operator+(const_iterator it, const difference_type n) noexcept { return it += n; }
+        [[nodiscard]] friend const_iterator operator+(const difference_type n, const_iterator it) noexcept { return it += n; }
+        [[nodiscard]] friend const_iterator operator-(const_iterator it, const difference_type n) noexcept { return it -= n; }
+        [[nodiscard]] friend difference_type operator-(const const_iterator &lhs, const const_iterator &rhs) noexcept {
+            return C_PTRDIFT(lhs.m_index) - C_PTRDIFT(rhs.m_index);
+        }
+
+        [[nodiscard]] bool operator==(const const_iterator &other) const noexcept { return m_index == other.m_index; }
+        [[nodiscard]] auto operator<=>(const const_iterator &other) const noexcept { return m_index <=> other.m_index; }
+
+    private:
+        const TokenStream *m_stream = nullptr;
+        std::size_t m_index = 0;
+    };
+
+    inline TokenStream::const_iterator TokenStream::begin() const noexcept { return const_iterator{this, 0}; }
+    inline TokenStream::const_iterator TokenStream::end() const noexcept { return const_iterator{this, size()}; }
+
+}  // namespace jsv
@@ -0,0 +1,279 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-pointer-arithmetic, *-reinterpret-cast, *-macro-usage)
+
+#pragma once
+
+#include "../../headers.hpp"
+#include "../CharClass.hpp"
+#include <bit>
+
+// clang-format off
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define JSV_SIMD_AVX2 1
+#define JSV_SIMD_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JSV_SIMD_SSE2 1
+#endif
+// clang-format on
+
+/// Block-wise byte scanners used by the lexer hot loops.
+///
+/// Every function has a scalar reference implementation in `detail` and, when
+/// the target supports it, an SSE2 (16 bytes) or AVX2 (32 bytes) path. Vector
+/// loads never read past `input.size()`: the last partial block is always
+/// finished by the scalar code, so results are identical on every target.
+namespace jsv::simd {
+
+    /// Result of `scan_string_body`.
+    struct StringBodyScan {
+        std::size_t end;     ///< Offset of the first `"`, `\\`, `\n` or `\r`, or `input.size()`
+        bool has_non_ascii;  ///< Whether any byte in [pos, end) is >= 0x80
+    };
+
+    namespace detail {
+
+        [[nodiscard]] constexpr bool is_string_special(const char c) noexcept { return c == '"' || c == '\\' || c == '\n' || c == '\r'; }
+
+        /// Scalar reference for `scan_string_body`.
+        [[nodiscard]] constexpr StringBodyScan scan_string_body_scalar(std::string_view input, std::size_t pos) noexcept {
+            bool non_ascii = false;
+            while(pos < input.size() && !is_string_special(input[pos])) {
+                non_ascii = non_ascii || C_UC(input[pos]) > 0x7FU;
+                ++pos;
+            }
+            return {pos, non_ascii};
+        }
+
+        /// Scalar reference for `find_block_comment_end`.
+        [[nodiscard]] constexpr std::size_t find_block_comment_end_scalar(std::string_view input, std::size_t pos) noexcept {
+            while(pos + 1 < input.size()) {
+                if(input[pos] == '*' && input[pos + 1] == '/') { return pos; }
+                ++pos;
+            }
+            return input.size();
+        }
+
+        /// Scalar reference for `skip_horizontal_space`.
+        [[nodiscard]] constexpr std::size_t skip_horizontal_space_scalar(std::string_view input, std::size_t pos) noexcept {
+            while(pos < input.size() && is_ascii_horizontal_space(input[pos])) { ++pos; }
+            return pos;
+        }
+
+        /// First byte of a possible line terminator: `\n`, or the 0xC2 / 0xE2
+        /// lead of NEL (U+0085) and LINE/PARAGRAPH SEPARATOR (U+2028/U+2029).
+        [[nodiscard]] constexpr bool is_line_break_lead(const char c) noexcept { return c == '\n' || C_UC(c) == 0xC2U || C_UC(c) == 0xE2U; }
+
+        /// Scalar reference for `find_line_break_candidate`.
+        [[nodiscard]] constexpr std::size_t find_line_break_candidate_scalar(std::string_view input, std::size_t pos) noexcept {
+            while(pos < input.size() && !is_line_break_lead(input[pos])) { ++pos; }
+            return pos;
+        }
+
+        /// Scalar reference for `find_byte`.
+        [[nodiscard]] constexpr std::size_t find_byte_scalar(std::string_view input, std::size_t pos, char needle) noexcept {
+            while(pos < input.size() && input[pos] != needle) { ++pos; }
+            return pos;
+        }
+
+#ifdef JSV_SIMD_SSE2
+        [[nodiscard]] inline __m128i load16(std::string_view input, std::size_t pos) noexcept {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i *>(input.data() + pos));
+        }
+
+        /// Bit i set iff byte i of the block is one of ' ', '\t', '\r', '\v', '\f'.
+        [[nodiscard]] inline std::uint32_t hspace_mask16(__m128i block) noexcept {
+            const __m128i space = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+            const __m128i tab = _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'));
+            const __m128i cr = _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'));
+            const __m128i vt = _mm_cmpeq_epi8(block, _mm_set1_epi8('\v'));
+            const __m128i ff = _mm_cmpeq_epi8(block, _mm_set1_epi8('\f'));
+            const __m128i any = _mm_or_si128(_mm_or_si128(_mm_or_si128(space, tab), _mm_or_si128(cr, vt)), ff);
+            return C_UI32T(_mm_movemask_epi8(any));
+        }
+
+        /// Bit i set iff byte i of the block is `"`, `\\`, `\n` or `\r`.
+        [[nodiscard]] inline std::uint32_t string_special_mask16(__m128i block) noexcept {
+            const __m128i quote = _mm_cmpeq_epi8(block, _mm_set1_epi8('"'));
+            const __m128i backslash = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+            const __m128i lf = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+            const __m128i cr = _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'));
+            return C_UI32T(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(quote, backslash), _mm_or_si128(lf, cr))));
+        }
+
+        /// Bit i set iff byte i of the block satisfies `is_line_break_lead`.
+        [[nodiscard]] inline std::uint32_t line_break_lead_mask16(__m128i block) noexcept {
+            const __m128i lf = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+            const __m128i c2 = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(0xC2)));
+            const __m128i e2 = _mm_cmpeq_epi8(block, _mm_set1_epi8(static_cast<char>(0xE2)));
+            return C_UI32T(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(lf, c2), e2)));
+        }
+#endif
+
+#ifdef JSV_SIMD_AVX2
+        [[nodiscard]] inline __m256i load32(std::string_view input, std::size_t pos) noexcept {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input.data() + pos));
+        }
+
+        [[nodiscard]] inline std::uint32_t hspace_mask32(__m256i block) noexcept {
+            const __m256i space = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' '));
+            const __m256i tab = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'));
+            const __m256i cr = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r'));
+            const __m256i vt = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\v'));
+            const __m256i ff = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\f'));
+            const __m256i any = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(space, tab), _mm256_or_si256(cr, vt)), ff);
+            return C_UI32T(_mm256_movemask_epi8(any));
+        }
+
+        [[nodiscard]] inline std::uint32_t string_special_mask32(__m256i block) noexcept {
+            const __m256i quote = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('"'));
+            const __m256i backslash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'));
+            const __m256i lf = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+            const __m256i cr = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r'));
+            return C_UI32T(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(quote, backslash), _mm256_or_si256(lf, cr))));
+        }
+
+        [[nodiscard]] inline std::uint32_t line_break_lead_mask32(__m256i block) noexcept {
+            const __m256i lf = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+            const __m256i c2 = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(0xC2)));
+            const __m256i e2 = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(static_cast<char>(0xE2)));
+            return C_UI32T(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(lf, c2), e2)));
+        }
+#endif
+
+        /// Bits of `high` strictly below the lowest set bit of `stop` (all of `high` if `stop` is 0).
+        [[nodiscard]] constexpr std::uint32_t bits_before(std::uint32_t high, std::uint32_t stop) noexcept {
+            return stop == 0 ? high : high & ((stop & (0U - stop)) - 1U);
+        }
+
+    }  // namespace detail
+
+    /// Return the offset of the first byte at or after `pos` that is not ASCII
+    /// horizontal whitespace (see `is_ascii_horizontal_space`), or `input.size()`.
+    [[nodiscard]] inline std::size_t skip_horizontal_space(std::string_view input, std::size_t pos) noexcept {
+#ifdef JSV_SIMD_AVX2
+        while(pos + 32 <= input.size()) {
+            const auto mask = detail::hspace_mask32(detail::load32(input, pos));
+            if(mask != 0xFFFFFFFFU) { return pos + C_ST(std::countr_one(mask)); }
+            pos += 32;
+        }
+#endif
+#ifdef JSV_SIMD_SSE2
+        while(pos + 16 <= input.size()) {
+            const auto mask = detail::hspace_mask16(detail::load16(input, pos));
+            if(mask != 0xFFFFU) { return pos + C_ST(std::countr_one(mask)); }
+            pos += 16;
+        }
+#endif
+        return detail::skip_horizontal_space_scalar(input, pos);
+    }
+
+    /// Return the offset of the first occurrence of `needle` at or after `pos`,
+    /// or `input.size()` if there is none.
+    [[nodiscard]] inline std::size_t find_byte(std::string_view input, std::size_t pos, char needle) noexcept {
+#ifdef JSV_SIMD_AVX2
+        const __m256i wanted32 = _mm256_set1_epi8(needle);
+        while(pos + 32 <= input.size()) {
+            const auto mask = C_UI32T(_mm256_movemask_epi8(_mm256_cmpeq_epi8(detail::load32(input, pos), wanted32)));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 32;
+        }
+#endif
+#ifdef JSV_SIMD_SSE2
+        const __m128i wanted16 = _mm_set1_epi8(needle);
+        while(pos + 16 <= input.size()) {
+            const auto mask = C_UI32T(_mm_movemask_epi8(_mm_cmpeq_epi8(detail::load16(input, pos), wanted16)));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 16;
+        }
+#endif
+        return detail::find_byte_scalar(input, pos, needle);
+    }
+
+    /// Find the end of the plain run of a string-literal body starting at `pos`:
+    /// the next byte the scanner must look at individually (`"`, `\\`, `\n`,
+    /// `\r`), and whether the bytes skipped on the way contain non-ASCII data
+    /// that still has to be UTF-8 validated.
+    [[nodiscard]] inline StringBodyScan scan_string_body(std::string_view input, std::size_t pos) noexcept {
+        std::uint32_t high = 0;
+#ifdef JSV_SIMD_AVX2
+        while(pos + 32 <= input.size()) {
+            const auto block = detail::load32(input, pos);
+            const auto stop = detail::string_special_mask32(block);
+            high |= detail::bits_before(C_UI32T(_mm256_movemask_epi8(block)), stop);
+            if(stop != 0) { return {pos + C_ST(std::countr_zero(stop)), high != 0}; }
+            pos += 32;
+        }
+#endif
+#ifdef JSV_SIMD_SSE2
+        while(pos + 16 <= input.size()) {
+            const auto block = detail::load16(input, pos);
+            const auto stop = detail::string_special_mask16(block);
+            high |= detail::bits_before(C_UI32T(_mm_movemask_epi8(block)), stop);
+            if(stop != 0) { return {pos + C_ST(std::countr_zero(stop)), high != 0}; }
+            pos += 16;
+        }
+#endif
+        const auto tail = detail::scan_string_body_scalar(input, pos);
+        return {tail.end, tail.has_non_ascii || high != 0};
+    }
+
+    /// Return the offset of the `*` of the first `*/` at or after `pos`, or
+    /// `input.size()` if the comment is unterminated. Each block compares the
+    /// window at `pos` against `*` and the window at `pos + 1` against `/`, so
+    /// a terminator straddling two blocks is still found in one pass.
+    [[nodiscard]] inline std::size_t find_block_comment_end(std::string_view input, std::size_t pos) noexcept {
+#ifdef JSV_SIMD_AVX2
+        const __m256i star32 = _mm256_set1_epi8('*');
+        const __m256i slash32 = _mm256_set1_epi8('/');
+        while(pos + 33 <= input.size()) {
+            const __m256i stars = _mm256_cmpeq_epi8(detail::load32(input, pos), star32);
+            const __m256i slashes = _mm256_cmpeq_epi8(detail::load32(input, pos + 1), slash32);
+            const auto mask = C_UI32T(_mm256_movemask_epi8(_mm256_and_si256(stars, slashes)));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 32;
+        }
+#endif
+#ifdef JSV_SIMD_SSE2
+        const __m128i star16 = _mm_set1_epi8('*');
+        const __m128i slash16 = _mm_set1_epi8('/');
+        while(pos + 17 <= input.size()) {
+            const __m128i stars = _mm_cmpeq_epi8(detail::load16(input, pos), star16);
+            const __m128i slashes = _mm_cmpeq_epi8(detail::load16(input, pos + 1), slash16);
+            const auto mask = C_UI32T(_mm_movemask_epi8(_mm_and_si128(stars, slashes)));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 16;
+        }
+#endif
+        return detail::find_block_comment_end_scalar(input, pos);
+    }
+
+    /// Return the offset of the first byte at or after `pos` that may start a
+    /// line terminator (see `detail::is_line_break_lead`), or `input.size()`.
+    /// The caller confirms the full sequence; plain text in Latin or CJK
+    /// scripts is skipped a whole block at a time.
+    [[nodiscard]] inline std::size_t find_line_break_candidate(std::string_view input, std::size_t pos) noexcept {
+#ifdef JSV_SIMD_AVX2
+        while(pos + 32 <= input.size()) {
+            const auto mask = detail::line_break_lead_mask32(detail::load32(input, pos));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 32;
+        }
+#endif
+#ifdef JSV_SIMD_SSE2
+        while(pos + 16 <= input.size()) {
+            const auto mask = detail::line_break_lead_mask16(detail::load16(input, pos));
+            if(mask != 0) { return pos + C_ST(std::countr_zero(mask)); }
+            pos += 16;
+        }
+#endif
+        return detail::find_line_break_candidate_scalar(input, pos);
+    }
+
+}  // namespace jsv::simd
+
+// NOLINTEND(*-magic-numbers, *-avoid-magic-numbers, *-pro-bounds-pointer-arithmetic, *-reinterpret-cast, *-macro-usage)
@@ -1,7 +1,7 @@
 /*
  * Generated by scripts/generate_unicode_tables.py
  * Unicode version: 16.0.0
- * Generation date: 2026-03-07
+ * Generation date: 2026-10-16
  * DO NOT EDIT — regenerate with: python scripts/generate_unicode_tables.py
  */
 
@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <span>
 
 namespace jsv::unicode {
@@ -647,12 +648,601 @@ namespace jsv::unicode {
         }(),
         "whitespace_ranges must be sorted and non-overlapping (required for binary search)");
 
+    // =========================================================================
+    // Three-stage lookup tables — one per classifier, built from the ranges above
+    // =========================================================================
+
+    /// Bitmap of one property over all code points, compressed in three stages:
+    /// `stage1[cp >> 10]` picks a block, `stage2[block * 16 + ((cp >> 6) & 15)]`
+    /// picks a 64-bit leaf, and bit `cp & 63` of the leaf is the property.
+    /// Identical blocks and leaves are stored once.
+    template <std::size_t Blocks, std::size_t Leaves> struct PropertyTable {
+        std::array<std::uint8_t, 1088> stage1;
+        std::array<std::uint16_t, Blocks * 16> stage2;
+        std::array<std::uint64_t, Leaves> leaves;
+
+        /// O(1): three dependent loads and no branches on the data.
+        [[nodiscard]] constexpr bool contains(const char32_t cp) const noexcept {
+            if(cp > U'\U0010FFFF') { return false; }
+            const std::size_t block = stage1[cp >> 10U];
+            const std::size_t leaf = stage2[block * 16U + ((cp >> 6U) & 15U)];
+            return ((leaves[leaf] >> (cp & 63U)) & 1U) != 0U;
+        }
+    };
+
+    static inline constexpr PropertyTable<56, 271> letter_table{
+        {{
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 12, 12, 12, 12, 12, 13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 15, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 9, 9, 9, 9, 9, 9, 9, 9, 17, 18,
+            19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 9, 29, 12, 30, 12, 12, 31, 32, 9, 9, 9, 9, 9, 9, 33, 9, 34, 35, 12, 12, 12, 12,
+            12, 36, 12, 37, 9, 9, 9, 9, 9, 9, 9, 38, 39, 9, 9, 40, 9, 9, 9, 9, 9, 41, 9, 42, 43, 44, 45, 46, 9, 9, 9, 9,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 47, 12, 12, 12, 48, 49, 12, 12, 12, 12, 50, 12, 12, 12, 12, 12, 12, 51, 52, 9, 9, 53, 9,
+            12, 12, 12, 12, 54, 12, 12, 12, 55, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        }},
+        {{
+            0, 1, 2, 3, 4, 4, 4, 4, 4, 4, 4, 5, 0, 6, 7, 8,
+            4, 4, 9, 4, 10, 11, 12, 13, 14, 15, 4, 16, 17, 18, 19, 20,
+            21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+            37, 38, 39, 40, 41, 42, 43, 44, 45, 44, 46, 47, 48, 49, 50, 0,
+            51, 52, 53, 54, 4, 4, 4, 4, 4, 55, 56, 57, 58, 59, 60, 61,
+            62, 4, 4, 4, 4, 4, 4, 4, 4, 63, 64, 65, 66, 67, 68, 69,
+            14, 70, 71, 72, 73, 74, 75, 24, 76, 77, 78, 0, 79, 80, 81, 82,
+            83, 84, 85, 86, 4, 4, 4, 0, 4, 4, 4, 4, 87, 88, 89, 90,
+            0, 91, 92, 0, 93, 94, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 96, 97, 98, 99, 100, 101, 0, 0, 0, 0, 0, 0, 0,
+            102, 62, 103, 104, 105, 4, 106, 107, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 108, 109, 4, 4, 4, 4, 110, 111, 112, 82, 113, 4, 114, 115,
+            116, 68, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 4, 129,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 130, 131,
+            0, 0, 0, 0, 4, 4, 4, 4, 4, 132, 4, 133, 134, 135, 136, 137,
+            4, 4, 4, 4, 138, 139, 140, 141, 0, 142, 4, 143, 144, 145, 146, 147,
+            148, 149, 4, 150, 0, 0, 0, 0, 0, 0, 151, 152, 153, 154, 112, 155,
+            4, 4, 156, 157, 158, 159, 160, 68, 4, 4, 4, 4, 161, 162, 163, 0,
+            164, 165, 73, 166, 167, 0, 168, 0, 169, 170, 171, 172, 72, 173, 174, 0,
+            4, 12, 175, 175, 83, 176, 177, 0, 0, 0, 178, 179, 180, 181, 182, 183,
+            184, 185, 186, 187, 188, 189, 190, 191, 192, 48, 193, 73, 33, 194, 195, 196,
+            197, 198, 199, 200, 0, 0, 201, 202, 199, 203, 204, 0, 59, 44, 0, 0,
+            205, 0, 14, 206, 207, 208, 209, 210, 211, 212, 213, 70, 0, 0, 0, 214,
+            215, 216, 217, 0, 218, 219, 220, 0, 0, 0, 0, 221, 222, 0, 223, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 133, 0,
+            0, 0, 4, 4, 4, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 225,
+            199, 226, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 150,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 44, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 70, 228, 146, 229, 199, 230, 217, 0,
+            0, 0, 0, 0, 0, 231, 0, 0, 0, 4, 0, 0, 4, 232, 233, 234,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 235,
+            4, 4, 4, 236, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 237,
+            4, 4, 4, 4, 238, 239, 4, 4, 4, 4, 4, 240, 0, 0, 0, 0,
+            4, 241, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 243, 244, 245, 246, 247, 4, 4, 4, 4, 248, 249, 250, 251, 252, 253,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 0, 0, 0,
+            107, 255, 0, 0, 256, 257, 0, 0, 0, 0, 229, 205, 0, 0, 0, 0,
+            0, 0, 0, 258, 0, 0, 0, 259, 0, 0, 0, 0, 0, 0, 0, 260,
+            4, 4, 4, 261, 4, 262, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 263, 264, 265, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 266, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 267, 4, 4, 4,
+            112, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 268, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 269,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 227, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 227, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 270, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 199, 0,
+        }},
+        {{
+            0x0000000000000000ULL, 0x07fffffe07fffffeULL, 0x0420040000000000ULL, 0xff7fffffff7fffffULL,
+            0xffffffffffffffffULL, 0x0000501f0003ffc3ULL, 0xbcdf000000000000ULL, 0xfffffffbffffd740ULL,
+            0xffbfffffffffffffULL, 0xfffffffffffffc03ULL, 0xfffeffffffffffffULL, 0xffffffff027fffffULL,
+            0x00000000000001ffULL, 0x000787ffffff0000ULL, 0xffffffff00000000ULL, 0xfffec000000007ffULL,
+            0x9c00c060002fffffULL, 0x0000fffffffd0000ULL, 0xffffffffffffe000ULL, 0x0002003fffffffffULL,
+            0x043007fffffffc00ULL, 0x00000110043fffffULL, 0xffff07ff01ffffffULL, 0xffffffff00007effULL,
+            0x00000000000003ffULL, 0x23fffffffffffff0ULL, 0xfffe0003ff010000ULL, 0x23c5fdfffff99fe1ULL,
+            0x10030003b0004000ULL, 0x036dfdfffff987e0ULL, 0x001c00005e000000ULL, 0x23edfdfffffbbfe0ULL,
+            0x0200000300010000ULL, 0x23edfdfffff99fe0ULL, 0x00020003b0000000ULL, 0x03ffc718d63dc7e8ULL,
+            0x0000000000010000ULL, 0x23fffdfffffddfe0ULL, 0x0000000327000000ULL, 0x23effdfffffddfe1ULL,
+            0x0006000360000000ULL, 0x27fffffffffddff0ULL, 0xfc00000380704000ULL, 0x2ffbfffffc7fffe0ULL,
+            0x000000000000007fULL, 0x000dfffffffffffeULL, 0x200dffaffffff7d6ULL, 0x00000000f000005fULL,
+            0x0000000000000001ULL, 0x00001ffffffffeffULL, 0x0000000000001f00ULL, 0x800007ffffffffffULL,
+            0xffe1c0623c3f0000ULL, 0xffffffff00004003ULL, 0xf7ffffffffff20bfULL, 0xffffffff3d7f3dffULL,
+            0x7f3dffffffff3dffULL, 0xffffffffff7fff3dULL, 0xffffffffff3dffffULL, 0x0000000007ffffffULL,
+            0xffffffff0000ffffULL, 0x3f3fffffffffffffULL, 0xfffffffffffffffeULL, 0xffff9fffffffffffULL,
+            0xffffffff07fffffeULL, 0x01fe07ffffffffffULL, 0x0003ffff8003ffffULL, 0x0001dfff0003ffffULL,
+            0x000fffffffffffffULL, 0x0000000010800000ULL, 0x01ffffffffffffffULL, 0xffff05ffffffff9fULL,
+            0x003fffffffffffffULL, 0x000000007fffffffULL, 0x001f3fffffff0000ULL, 0xffff0fffffffffffULL,
+            0xffffffff007fffffULL, 0x00000000001fffffULL, 0x0000008000000000ULL, 0x000fffffffffffe0ULL,
+            0x0000000000001fe0ULL, 0xfc00c001fffffff8ULL, 0x0000003fffffffffULL, 0x0000000fffffffffULL,
+            0x3ffffffffc00e000ULL, 0xe7ffffffffff07ffULL, 0x046fde0000000000ULL, 0xffffffff3f3fffffULL,
+            0x3fffffffaaff3f3fULL, 0x5fdfffffffffffffULL, 0x1fdc1fff0fcf1fdcULL, 0x8002000000000000ULL,
+            0x000000001fff0000ULL, 0xf3ffbd503e2ffc84ULL, 0x00000000000043e0ULL, 0x0000000000000018ULL,
+            0x000c781fffffffffULL, 0xffff20bfffffffffULL, 0x000080ffffffffffULL, 0x7f7f7f7f007fffffULL,
+            0x000000007f7f7f7fULL, 0x0000800000000000ULL, 0x183e000000000060ULL, 0xfffffffee07fffffULL,
+            0xf7ffffffffffffffULL, 0xfffeffffffffffe0ULL, 0xffffffff00007fffULL, 0xffff000000000000ULL,
+            0x0000000000001fffULL, 0x3fffffffffff0000ULL, 0x00000c00ffff1fffULL, 0x80007fffffffffffULL,
+            0xffffffff3fffffffULL, 0xfffffffcff800000ULL, 0xfffffffffffff9ffULL, 0xfffc00001feb3fffULL,
+            0x00000007fffff7bbULL, 0x000ffffffffffffcULL, 0x68fc000000000000ULL, 0xffff003ffffffc00ULL,
+            0x1fffffff0000007fULL, 0x0007fffffffffff0ULL, 0x7c00ffdf00008000ULL, 0x000001ffffffffffULL,
+            0xc47fffff00000ff7ULL, 0x3e62ffffffffffffULL, 0x001c07ff38000005ULL, 0xffff7f7f007e7e7eULL,
+            0xffff03fff7ffffffULL, 0x00000007ffffffffULL, 0xffff000fffffffffULL, 0x0ffffffffffff87fULL,
+            0xffff3fffffffffffULL, 0x0000000003ffffffULL, 0x5f7ffdffa0f8007fULL, 0xffffffffffffffdbULL,
+            0x0003ffffffffffffULL, 0xfffffffffff80000ULL, 0x3fffffffffffffffULL, 0xffffffffffff0000ULL,
+            0xfffffffffffcffffULL, 0x0fff0000000000ffULL, 0xffdf000000000000ULL, 0x1fffffffffffffffULL,
+            0x07fffffe00000000ULL, 0xffffffc007fffffeULL, 0x7fffffffffffffffULL, 0x000000001cfcfcfcULL,
+            0xb7ffff7fffffefffULL, 0x000000003fff3fffULL, 0x07ffffffffffffffULL, 0xffffffff1fffffffULL,
+            0x000000000001ffffULL, 0xffffe000ffffffffULL, 0x003fffffffff03fdULL, 0x000000000000ff0fULL,
+            0xffff00003fffffffULL, 0x0fffffffff0fffffULL, 0xffff00ffffffffffULL, 0xf7ff000fffffffffULL,
+            0x1bfbfffbffb7f7ffULL, 0x007fffffffffffffULL, 0x000000ff003fffffULL, 0x07fdffffffffffbfULL,
+            0x91bffffffffffd3fULL, 0x007fffff003fffffULL, 0x0037ffff00000000ULL, 0x03ffffff003fffffULL,
+            0xc0ffffffffffffffULL, 0x003ffffffeef0001ULL, 0x1fffffff00000000ULL, 0x000000001fffffffULL,
+            0x0000001ffffffeffULL, 0x0007ffff003fffffULL, 0x000000000003ffffULL, 0x0007ffffffffffffULL,
+            0xffff803ffffffc00ULL, 0x000000000000003fULL, 0x000303ffffffffffULL, 0x000000000000001cULL,
+            0xffff00801fffffffULL, 0xffff00000000003fULL, 0xffff000000000003ULL, 0x007fffff0000001fULL,
+            0x00fffffffffffff8ULL, 0x0026000000000000ULL, 0x0000fffffffffff8ULL, 0x000001ffffff0000ULL,
+            0x0000007ffffffff8ULL, 0x0047ffffffff0090ULL, 0x0007fffffffffff8ULL, 0x000000001400001eULL,
+            0x80000ffffffbffffULL, 0xffff01ffbfffbd7fULL, 0x00000003e0010000ULL, 0x00bfffffffff4bffULL,
+            0x00000000000a0000ULL, 0x001fffffffffffffULL, 0x0000000380000780ULL, 0x0000ffffffffffffULL,
+            0x00000000000000b0ULL, 0x00007fffffffffffULL, 0x000000000f000000ULL, 0x0000000000000010ULL,
+            0x010007ffffffffffULL, 0x00000fffffffffffULL, 0x80000000ffffffffULL, 0x8000ffffff6ff27fULL,
+            0x0000000000000002ULL, 0xfffffcff00000000ULL, 0x0000000a0001ffffULL, 0x0407fffffffff801ULL,
+            0xfffffffff0010000ULL, 0xffff0000200003ffULL, 0x00000001ffffffffULL, 0x00007ffffffffdffULL,
+            0xfffc000000000001ULL, 0x000000000000ffffULL, 0x0001fffffffffb7fULL, 0xfffffdbf00000040ULL,
+            0x00000000010003ffULL, 0x0007ffff00000000ULL, 0x000ffffffffdfff4ULL, 0x0001000000000000ULL,
+            0x000000000000000fULL, 0x0001ffffffffffffULL, 0xffffffff0000007eULL, 0x000000003fffffffULL,
+            0xffff00007fffffffULL, 0x00003fffffff0000ULL, 0xe0fffff80000000fULL, 0x00001fffffffffffULL,
+            0x00000000000107ffULL, 0x00000000fff80000ULL, 0x0000000b00000000ULL, 0x00ffffffffffffffULL,
+            0x80000000003fffffULL, 0x6fef000000000000ULL, 0x00040007ffffffffULL, 0xffff00f000270000ULL,
+            0x0fffffffffffffffULL, 0x1fff07ffffffffffULL, 0x0000000003ff01ffULL, 0xffffffffffdfffffULL,
+            0xebffde64dfffffffULL, 0xffffffffffffffefULL, 0x7bffffffdfdfe7bfULL, 0xfffffffffffdfc5fULL,
+            0xffffff3fffffffffULL, 0xf7fffffff7fffffdULL, 0xffdfffffffdfffffULL, 0xffff7fffffff7fffULL,
+            0xfffffdfffffffdffULL, 0x0000000000000ff7ULL, 0x000007e07fffffffULL, 0x00003fffffffffffULL,
+            0x3f801fffffffffffULL, 0x0000000000004000ULL, 0x00000fffffff0000ULL, 0x00013fffffff0000ULL,
+            0x7fff6f7f00000000ULL, 0x000000000000001fULL, 0x000000000000080fULL, 0x0af7fe96ffffffefULL,
+            0x5ef7f796aa96ea84ULL, 0x0ffffbee0ffffbffULL, 0x00000000ffffffffULL, 0x03ffffffffffffffULL,
+            0xffff0003ffffffffULL, 0xffff0001ffffffffULL, 0xffffffffffff07ffULL,
+        }},
+    };
+
+    static inline constexpr PropertyTable<56, 270> id_start_table{
+        {{
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 12, 12, 12, 12, 12, 12, 13, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 14, 15, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 16, 9, 9, 9, 9, 9, 9, 9, 9, 17, 18,
+            19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 9, 29, 12, 30, 12, 12, 31, 32, 9, 9, 9, 9, 9, 9, 33, 9, 34, 35, 12, 12, 12, 12,
+            12, 36, 12, 37, 9, 9, 9, 9, 9, 9, 9, 38, 39, 9, 9, 40, 9, 9, 9, 9, 9, 41, 9, 42, 43, 44, 45, 46, 9, 9, 9, 9,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+            12, 12, 12, 12, 12, 12, 12, 12, 12, 47, 12, 12, 12, 48, 49, 12, 12, 12, 12, 50, 12, 12, 12, 12, 12, 12, 51, 52, 9, 9, 53, 9,
+            12, 12, 12, 12, 54, 12, 12, 12, 55, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        }},
+        {{
+            0, 1, 2, 3, 4, 4, 4, 4, 4, 4, 4, 5, 0, 6, 7, 8,
+            4, 4, 9, 4, 10, 11, 12, 13, 14, 15, 4, 16, 17, 18, 19, 20,
+            21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+            37, 38, 39, 40, 41, 42, 43, 44, 45, 44, 46, 47, 48, 49, 50, 0,
+            51, 52, 53, 54, 4, 4, 4, 4, 4, 55, 56, 57, 58, 59, 60, 61,
+            62, 4, 4, 4, 4, 4, 4, 4, 4, 63, 64, 65, 66, 67, 68, 69,
+            14, 70, 71, 72, 73, 74, 75, 24, 76, 77, 78, 0, 79, 80, 81, 82,
+            83, 84, 85, 86, 4, 4, 4, 0, 4, 4, 4, 4, 87, 88, 89, 90,
+            0, 91, 92, 0, 93, 94, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 95, 96, 97, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0,
+            101, 62, 102, 103, 104, 4, 105, 106, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 107, 108, 4, 4, 4, 4, 109, 110, 111, 112, 113, 4, 114, 115,
+            116, 68, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 4, 129,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 130, 131,
+            0, 0, 0, 0, 4, 4, 4, 4, 4, 132, 4, 133, 134, 135, 136, 137,
+            4, 4, 4, 4, 138, 139, 140, 141, 0, 142, 4, 143, 144, 145, 146, 147,
+            148, 149, 4, 150, 0, 151, 0, 0, 0, 0, 152, 153, 154, 155, 111, 156,
+            4, 4, 157, 158, 159, 160, 161, 68, 4, 4, 4, 4, 162, 163, 164, 0,
+            165, 166, 73, 167, 168, 0, 169, 0, 170, 171, 172, 173, 72, 174, 175, 0,
+            4, 12, 176, 176, 83, 177, 178, 0, 0, 0, 179, 180, 181, 182, 183, 184,
+            185, 186, 187, 188, 189, 190, 191, 192, 193, 48, 194, 73, 33, 195, 196, 197,
+            151, 198, 112, 199, 0, 0, 200, 201, 112, 202, 203, 0, 59, 44, 0, 0,
+            204, 0, 14, 205, 206, 207, 208, 209, 210, 211, 212, 70, 0, 0, 0, 213,
+            214, 215, 216, 0, 217, 218, 219, 0, 0, 0, 0, 220, 221, 0, 222, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 133, 0,
+            4, 200, 4, 4, 4, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 224,
+            112, 225, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 150,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 44, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 226, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 70, 227, 146, 228, 112, 229, 216, 0,
+            0, 0, 0, 0, 0, 230, 0, 0, 0, 4, 0, 0, 4, 231, 232, 233,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 234,
+            4, 4, 4, 235, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236,
+            4, 4, 4, 4, 237, 238, 4, 4, 4, 4, 4, 239, 0, 0, 0, 0,
+            4, 240, 241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            4, 242, 243, 244, 245, 246, 4, 4, 4, 4, 247, 248, 249, 250, 251, 252,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 0, 0, 0,
+            106, 254, 0, 0, 255, 256, 0, 0, 0, 0, 228, 204, 0, 0, 0, 0,
+            0, 0, 0, 257, 0, 0, 0, 258, 0, 0, 0, 0, 0, 0, 0, 259,
+            4, 4, 4, 260, 4, 261, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 262, 263, 264, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 265, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 266, 4, 4, 4,
+            111, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 267, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 268,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 226, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 226, 0, 0, 0, 0, 0, 0, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 269, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 112, 0,
+        }},
+        {{
+            0x0000000000000000ULL, 0x07fffffe07fffffeULL, 0x0420040000000000ULL, 0xff7fffffff7fffffULL,
+            0xffffffffffffffffULL, 0x0000501f0003ffc3ULL, 0xbcdf000000000000ULL, 0xfffffffbffffd740ULL,
+            0xffbfffffffffffffULL, 0xfffffffffffffc03ULL, 0xfffeffffffffffffULL, 0xffffffff027fffffULL,
+            0x00000000000001ffULL, 0x000787ffffff0000ULL, 0xffffffff00000000ULL, 0xfffec000000007ffULL,
+            0x9c00c060002fffffULL, 0x0000fffffffd0000ULL, 0xffffffffffffe000ULL, 0x0002003fffffffffULL,
+            0x043007fffffffc00ULL, 0x00000110043fffffULL, 0xffff07ff01ffffffULL, 0xffffffff00007effULL,
+            0x00000000000003ffULL, 0x23fffffffffffff0ULL, 0xfffe0003ff010000ULL, 0x23c5fdfffff99fe1ULL,
+            0x10030003b0004000ULL, 0x036dfdfffff987e0ULL, 0x001c00005e000000ULL, 0x23edfdfffffbbfe0ULL,
+            0x0200000300010000ULL, 0x23edfdfffff99fe0ULL, 0x00020003b0000000ULL, 0x03ffc718d63dc7e8ULL,
+            0x0000000000010000ULL, 0x23fffdfffffddfe0ULL, 0x0000000327000000ULL, 0x23effdfffffddfe1ULL,
+            0x0006000360000000ULL, 0x27fffffffffddff0ULL, 0xfc00000380704000ULL, 0x2ffbfffffc7fffe0ULL,
+            0x000000000000007fULL, 0x000dfffffffffffeULL, 0x200dffaffffff7d6ULL, 0x00000000f000005fULL,
+            0x0000000000000001ULL, 0x00001ffffffffeffULL, 0x0000000000001f00ULL, 0x800007ffffffffffULL,
+            0xffe1c0623c3f0000ULL, 0xffffffff00004003ULL, 0xf7ffffffffff20bfULL, 0xffffffff3d7f3dffULL,
+            0x7f3dffffffff3dffULL, 0xffffffffff7fff3dULL, 0xffffffffff3dffffULL, 0x0000000007ffffffULL,
+            0xffffffff0000ffffULL, 0x3f3fffffffffffffULL, 0xfffffffffffffffeULL, 0xffff9fffffffffffULL,
+            0xffffffff07fffffeULL, 0x01ffc7ffffffffffULL, 0x0003ffff8003ffffULL, 0x0001dfff0003ffffULL,
+            0x000fffffffffffffULL, 0x0000000010800000ULL, 0x01ffffffffffffffULL, 0xffff05ffffffff9fULL,
+            0x003fffffffffffffULL, 0x000000007fffffffULL, 0x001f3fffffff0000ULL, 0xffff0fffffffffffULL,
+            0xffffffff007fffffULL, 0x00000000001fffffULL, 0x0000008000000000ULL, 0x000fffffffffffe0ULL,
+            0x0000000000001fe0ULL, 0xfc00c001fffffff8ULL, 0x0000003fffffffffULL, 0x0000000fffffffffULL,
+            0x3ffffffffc00e000ULL, 0xe7ffffffffff07ffULL, 0x046fde0000000000ULL, 0xffffffff3f3fffffULL,
+            0x3fffffffaaff3f3fULL, 0x5fdfffffffffffffULL, 0x1fdc1fff0fcf1fdcULL, 0x8002000000000000ULL,
+            0x000000001fff0000ULL, 0xf3ffbd503e2ffc84ULL, 0xffffffff000043e0ULL, 0x000c781fffffffffULL,
+            0xffff20bfffffffffULL, 0x000080ffffffffffULL, 0x7f7f7f7f007fffffULL, 0x000000007f7f7f7fULL,
+            0x0000800000000000ULL, 0x1f3e03fe000000e0ULL, 0xfffffffee07fffffULL, 0xf7ffffffffffffffULL,
+            0xfffeffffffffffe0ULL, 0xffffffff00007fffULL, 0xffff000000000000ULL, 0x0000000000001fffULL,
+            0x3fffffffffff0000ULL, 0x00000c00ffff1fffULL, 0x80007fffffffffffULL, 0xffffffff3fffffffULL,
+            0x0000ffffffffffffULL, 0xfffffffcff800000ULL, 0xfffffffffffff9ffULL, 0xfffc00001feb3fffULL,
+            0x00000007fffff7bbULL, 0x000ffffffffffffcULL, 0x68fc000000000000ULL, 0xffff003ffffffc00ULL,
+            0x1fffffff0000007fULL, 0x0007fffffffffff0ULL, 0x7c00ffdf00008000ULL, 0x000001ffffffffffULL,
+            0xc47fffff00000ff7ULL, 0x3e62ffffffffffffULL, 0x001c07ff38000005ULL, 0xffff7f7f007e7e7eULL,
+            0xffff03fff7ffffffULL, 0x00000007ffffffffULL, 0xffff000fffffffffULL, 0x0ffffffffffff87fULL,
+            0xffff3fffffffffffULL, 0x0000000003ffffffULL, 0x5f7ffdffa0f8007fULL, 0xffffffffffffffdbULL,
+            0x0003ffffffffffffULL, 0xfffffffffff80000ULL, 0x3fffffffffffffffULL, 0xffffffffffff0000ULL,
+            0xfffffffffffcffffULL, 0x0fff0000000000ffULL, 0xffdf000000000000ULL, 0x1fffffffffffffffULL,
+            0x07fffffe00000000ULL, 0xffffffc007fffffeULL, 0x7fffffffffffffffULL, 0x000000001cfcfcfcULL,
+            0xb7ffff7fffffefffULL, 0x000000003fff3fffULL, 0x07ffffffffffffffULL, 0x001fffffffffffffULL,
+            0xffffffff1fffffffULL, 0x000000000001ffffULL, 0xffffe000ffffffffULL, 0x003fffffffff07ffULL,
+            0x00000000003eff0fULL, 0xffff00003fffffffULL, 0x0fffffffff0fffffULL, 0xffff00ffffffffffULL,
+            0xf7ff000fffffffffULL, 0x1bfbfffbffb7f7ffULL, 0x007fffffffffffffULL, 0x000000ff003fffffULL,
+            0x07fdffffffffffbfULL, 0x91bffffffffffd3fULL, 0x007fffff003fffffULL, 0x0037ffff00000000ULL,
+            0x03ffffff003fffffULL, 0xc0ffffffffffffffULL, 0x003ffffffeef0001ULL, 0x1fffffff00000000ULL,
+            0x000000001fffffffULL, 0x0000001ffffffeffULL, 0x0007ffff003fffffULL, 0x000000000003ffffULL,
+            0x0007ffffffffffffULL, 0xffff803ffffffc00ULL, 0x000000000000003fULL, 0x000303ffffffffffULL,
+            0x000000000000001cULL, 0xffff00801fffffffULL, 0xffff00000000003fULL, 0xffff000000000003ULL,
+            0x007fffff0000001fULL, 0x00fffffffffffff8ULL, 0x0026000000000000ULL, 0x0000fffffffffff8ULL,
+            0x000001ffffff0000ULL, 0x0000007ffffffff8ULL, 0x0047ffffffff0090ULL, 0x0007fffffffffff8ULL,
+            0x000000001400001eULL, 0x80000ffffffbffffULL, 0xffff01ffbfffbd7fULL, 0x00000003e0010000ULL,
+            0x00bfffffffff4bffULL, 0x00000000000a0000ULL, 0x0000000380000780ULL, 0x00000000000000b0ULL,
+            0x00007fffffffffffULL, 0x000000000f000000ULL, 0x0000000000000010ULL, 0x010007ffffffffffULL,
+            0x00000fffffffffffULL, 0x80000000ffffffffULL, 0x8000ffffff6ff27fULL, 0x0000000000000002ULL,
+            0xfffffcff00000000ULL, 0x0000000a0001ffffULL, 0x0407fffffffff801ULL, 0xfffffffff0010000ULL,
+            0xffff0000200003ffULL, 0x00000001ffffffffULL, 0x00007ffffffffdffULL, 0xfffc000000000001ULL,
+            0x000000000000ffffULL, 0x0001fffffffffb7fULL, 0xfffffdbf00000040ULL, 0x00000000010003ffULL,
+            0x0007ffff00000000ULL, 0x000ffffffffdfff4ULL, 0x0001000000000000ULL, 0x000000000000000fULL,
+            0x0001ffffffffffffULL, 0xffffffff0000007eULL, 0x000000003fffffffULL, 0xffff00007fffffffULL,
+            0x00003fffffff0000ULL, 0xe0fffff80000000fULL, 0x00001fffffffffffULL, 0x00000000000107ffULL,
+            0x00000000fff80000ULL, 0x0000000b00000000ULL, 0x00ffffffffffffffULL, 0x80000000003fffffULL,
+            0x6fef000000000000ULL, 0x00040007ffffffffULL, 0xffff00f000270000ULL, 0x0fffffffffffffffULL,
+            0x1fff07ffffffffffULL, 0x0000000003ff01ffULL, 0xffffffffffdfffffULL, 0xebffde64dfffffffULL,
+            0xffffffffffffffefULL, 0x7bffffffdfdfe7bfULL, 0xfffffffffffdfc5fULL, 0xffffff3fffffffffULL,
+            0xf7fffffff7fffffdULL, 0xffdfffffffdfffffULL, 0xffff7fffffff7fffULL, 0xfffffdfffffffdffULL,
+            0x0000000000000ff7ULL, 0x000007e07fffffffULL, 0x00003fffffffffffULL, 0x3f801fffffffffffULL,
+            0x0000000000004000ULL, 0x00000fffffff0000ULL, 0x00013fffffff0000ULL, 0x7fff6f7f00000000ULL,
+            0x000000000000001fULL, 0x000000000000080fULL, 0x0af7fe96ffffffefULL, 0x5ef7f796aa96ea84ULL,
+            0x0ffffbee0ffffbffULL, 0x00000000ffffffffULL, 0x03ffffffffffffffULL, 0xffff0003ffffffffULL,
+            0xffff0001ffffffffULL, 0xffffffffffff07ffULL,
+        }},
+    };
+
+    static inline constexpr PropertyTable<63, 297> id_continue_table{
+        {{
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13, 13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+            13, 13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 17, 10, 10, 10, 10, 10, 10, 10, 10, 18, 19,
+            20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 10, 30, 13, 31, 13, 13, 32, 33, 10, 10, 10, 10, 10, 10, 34, 10, 35, 36, 13, 13, 13, 13,
+            13, 37, 13, 38, 10, 10, 10, 10, 10, 10, 10, 39, 40, 10, 10, 41, 10, 10, 10, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 10, 52, 10,
+            13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+            13, 13, 13, 13, 13, 13, 13, 13, 13, 53, 13, 13, 13, 54, 55, 13, 13, 13, 13, 56, 13, 13, 13, 13, 13, 13, 57, 58, 10, 10, 59, 10,
+            13, 13, 13, 13, 60, 13, 13, 13, 61, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            62, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        }},
+        {{
+            0, 1, 2, 3, 4, 4, 4, 4, 4, 4, 4, 5, 4, 6, 7, 8,
+            4, 4, 9, 4, 10, 11, 12, 13, 14, 15, 4, 16, 17, 18, 19, 20,
+            21, 22, 23, 24, 4, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+            36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+            4, 52, 53, 54, 4, 4, 4, 4, 4, 55, 56, 57, 58, 59, 60, 61,
+            62, 4, 4, 4, 4, 4, 4, 4, 4, 63, 64, 65, 66, 67, 4, 68,
+            69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 4, 81, 4, 82,
+            83, 84, 85, 86, 4, 4, 4, 4, 4, 4, 4, 4, 87, 88, 89, 90,
+            91, 92, 93, 94, 95, 96, 97, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 99, 100, 101, 98, 98, 98, 98, 98, 98, 98, 98, 98, 102, 103, 98,
+            98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            4, 4, 4, 104, 105, 106, 107, 108, 109, 98, 98, 98, 98, 98, 98, 98,
+            110, 62, 111, 112, 113, 4, 114, 115, 116, 117, 118, 98, 98, 98, 98, 98,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 98, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 119, 120, 4, 4, 4, 4, 121, 122, 4, 19, 123, 4, 124, 125,
+            126, 82, 4, 127, 128, 129, 4, 130, 131, 132, 4, 133, 134, 135, 4, 136,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 137, 138,
+            98, 98, 98, 98, 4, 4, 4, 4, 4, 128, 4, 139, 140, 141, 19, 142,
+            4, 4, 4, 4, 143, 17, 144, 145, 146, 147, 4, 148, 149, 150, 151, 152,
+            153, 154, 4, 155, 156, 70, 157, 158, 98, 98, 159, 160, 161, 162, 53, 163,
+            4, 4, 164, 165, 166, 167, 168, 82, 4, 4, 4, 4, 131, 169, 170, 98,
+            171, 172, 173, 174, 175, 98, 176, 144, 177, 178, 179, 180, 72, 181, 182, 98,
+            4, 183, 184, 185, 186, 187, 188, 98, 98, 189, 190, 191, 166, 192, 193, 194,
+            4, 195, 155, 196, 197, 198, 4, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+            4, 208, 4, 209, 98, 98, 210, 211, 4, 212, 70, 213, 214, 215, 98, 98,
+            155, 98, 99, 216, 217, 218, 219, 220, 151, 221, 222, 70, 98, 98, 98, 223,
+            224, 225, 226, 98, 227, 228, 229, 98, 98, 98, 98, 230, 231, 232, 233, 234,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 139, 98,
+            4, 235, 4, 4, 4, 236, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 17, 237,
+            238, 239, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 155,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 215, 98, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 240, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            4, 4, 4, 4, 4, 4, 4, 4, 70, 241, 151, 242, 131, 243, 244, 98,
+            98, 98, 98, 98, 98, 245, 98, 98, 98, 4, 246, 98, 4, 247, 248, 249,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 83,
+            4, 4, 4, 250, 183, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 251,
+            4, 4, 4, 4, 252, 253, 4, 4, 4, 4, 4, 254, 98, 98, 98, 98,
+            4, 255, 256, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 98, 98, 0, 98, 98, 98, 98, 98, 98, 98, 98, 128, 215, 98, 98,
+            98, 98, 98, 98, 98, 257, 258, 98, 98, 259, 98, 260, 98, 261, 98, 98,
+            4, 262, 263, 264, 265, 266, 4, 4, 4, 4, 267, 268, 269, 270, 271, 272,
+            98, 98, 98, 98, 98, 98, 98, 98, 273, 274, 275, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 276, 98, 98, 98,
+            277, 21, 278, 98, 279, 280, 98, 98, 98, 98, 281, 240, 98, 98, 98, 98,
+            98, 98, 98, 282, 98, 98, 98, 283, 98, 98, 98, 98, 98, 98, 98, 284,
+            4, 4, 4, 285, 4, 286, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 287, 288, 98, 289, 98, 98, 98, 290, 291, 292, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 119, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+            98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 0,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 179, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 240, 4, 4, 4,
+            53, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 293, 4, 4, 4, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 294,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 295, 98, 98, 98, 98, 98, 98,
+            4, 4, 4, 4, 4, 4, 4, 4, 295, 98, 98, 98, 98, 98, 98, 98,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 296, 4, 4,
+            4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 238, 98,
+            98, 98, 98, 98, 4, 4, 4, 238, 98, 98, 98, 98, 98, 98, 98, 98,
+        }},
+        {{
+            0x03ff000000000000ULL, 0x07fffffe87fffffeULL, 0x762c040000000000ULL, 0xff7fffffff7fffffULL,
+            0xffffffffffffffffULL, 0x0000501f0003ffc3ULL, 0xbcdfffffffffffffULL, 0xfffffffbffffd740ULL,
+            0xffbfffffffffffffULL, 0xfffffffffffffffbULL, 0xfffeffffffffffffULL, 0xffffffff027fffffULL,
+            0xbffffffffffe01ffULL, 0x000787ffffff00b6ULL, 0xffffffff07ff0000ULL, 0xffffc3ffffffffffULL,
+            0x9ffffdff9fefffffULL, 0xffffffffffff0000ULL, 0xffffffffffffe7ffULL, 0x0003ffffffffffffULL,
+            0x243fffffffffffffULL, 0x00003fffffffffffULL, 0xffff07ff0fffffffULL, 0xffffffffff807effULL,
+            0xfffffffbffffffffULL, 0xfffeffcfffffffffULL, 0xf3c5fdfffff99fefULL, 0x53f3ffcfb080799fULL,
+            0xd36dfdfffff987eeULL, 0x003fffc05e023987ULL, 0xf3edfdfffffbbfeeULL, 0xfe00ffcf00013bbfULL,
+            0xf3edfdfffff99feeULL, 0x00feffcfb0e0399fULL, 0xc3ffc718d63dc7ecULL, 0x0007ffc000813dc7ULL,
+            0xf3fffdfffffddfffULL, 0x7f00ffcf27603ddfULL, 0xf3effdfffffddfefULL, 0x000effcf60603ddfULL,
+            0xfffffffffffddfffULL, 0xfdffffcffff07ddfULL, 0x2ffbfffffc7fffeeULL, 0x000cffc0ff5f847fULL,
+            0x07fffffffffffffeULL, 0x0000000003ff7fffULL, 0x3fffffaffffff7d6ULL, 0x00000000f3ff7f5fULL,
+            0xc2afffff03000001ULL, 0xfffe1ffffffffeffULL, 0x1ffffffffeffffdfULL, 0x0000000000000040ULL,
+            0xffffffffffff03ffULL, 0xffffffff3fffffffULL, 0xf7ffffffffff20bfULL, 0xffffffff3d7f3dffULL,
+            0x7f3dffffffff3dffULL, 0xffffffffff7fff3dULL, 0xffffffffff3dffffULL, 0x1ffffe00e7ffffffULL,
+            0xffffffff0000ffffULL, 0x3f3fffffffffffffULL, 0xfffffffffffffffeULL, 0xffff9fffffffffffULL,
+            0xffffffff07fffffeULL, 0x01ffc7ffffffffffULL, 0x001fffff803fffffULL, 0x000ddfff000fffffULL,
+            0x03ff03ff308fffffULL, 0xffffffff03ffb800ULL, 0x01ffffffffffffffULL, 0xffff07ffffffffffULL,
+            0x003fffffffffffffULL, 0x0fff0fff7fffffffULL, 0x001f3fffffffffc0ULL, 0xffff0fffffffffffULL,
+            0x0000000007ff03ffULL, 0xffffffff0fffffffULL, 0x9fffffff7fffffffULL, 0xffff008003ff03ffULL,
+            0x0000000000007fffULL, 0x000ff80003ff1fffULL, 0x000fffffffffffffULL, 0x00ffffffffffffffULL,
+            0x3fffffffffffe3ffULL, 0xe7ffffffffff07ffULL, 0x07fffffffff70000ULL, 0xffffffff3f3fffffULL,
+            0x3fffffffaaff3f3fULL, 0x5fdfffffffffffffULL, 0x1fdc1fff0fcf1fdcULL, 0x8000000000000000ULL,
+            0x83f3000000100001ULL, 0x000000001fff03ffULL, 0x0001ffffffff0000ULL, 0xf3ffbd503e2ffc84ULL,
+            0xffffffffffff43e0ULL, 0x00000000000003ffULL, 0x0000000000000000ULL, 0xffffffff00000000ULL,
+            0x000000000fffffffULL, 0xfffffc0000000000ULL, 0xffc0000000000000ULL, 0x00000000000fffffULL,
+            0x200ff81fffffffffULL, 0xffff20bfffffffffULL, 0x800080ffffffffffULL, 0x7f7f7f7f007fffffULL,
+            0xffffffff7f7f7f7fULL, 0x0000800000000000ULL, 0x1f3efffe000000e0ULL, 0xfffffffee67fffffULL,
+            0xf7ffffffffffffffULL, 0xfffeffffffffffe0ULL, 0xffffffff003c7fffULL, 0xffff000000000000ULL,
+            0x000003ff00000000ULL, 0x00000000fffeff00ULL, 0xfffe0000000003ffULL, 0x0000000000001fffULL,
+            0x3fffffffffff0000ULL, 0x00000fffffff1fffULL, 0xbff7ffffffffffffULL, 0xfffffffcff800000ULL,
+            0xfffffffffffff9ffULL, 0xfffc00001feb3fffULL, 0x003f10ffffffffffULL, 0xe8ffffff03ff003fULL,
+            0xffff3fffffffffffULL, 0x1fffffff000fffffULL, 0x7fffffff03ff8001ULL, 0x007fffffffffffffULL,
+            0xfc7fffff03ff3fffULL, 0x007cffff38000007ULL, 0xffff7f7f007e7e7eULL, 0xffff03fff7ffffffULL,
+            0x03ff37ffffffffffULL, 0xffff000fffffffffULL, 0x0ffffffffffff87fULL, 0x0000000003ffffffULL,
+            0x5f7ffdffe0f8007fULL, 0xffffffffffffffdbULL, 0xfffffffffff80000ULL, 0x3fffffffffffffffULL,
+            0xfffffffffffcffffULL, 0x0fff0000000000ffULL, 0x0018ffff0000ffffULL, 0xffdf00000000e000ULL,
+            0x1fffffffffffffffULL, 0x87fffffe03ff0000ULL, 0xffffffc007fffffeULL, 0x7fffffffffffffffULL,
+            0x000000001cfcfcfcULL, 0xb7ffff7fffffefffULL, 0x000000003fff3fffULL, 0x07ffffffffffffffULL,
+            0x000fffffffffff80ULL, 0x0000000000000c00ULL, 0x2000000000000000ULL, 0xffffffff1fffffffULL,
+            0x0fffffff0001ffffULL, 0xffffe00fffffffffULL, 0x07ffffffffff07ffULL, 0x00000000003eff0fULL,
+            0xffff03ff3fffffffULL, 0x0fffffffff0fffffULL, 0xffff00ffffffffffULL, 0xf7ff000fffffffffULL,
+            0x1bfbfffbffb7f7ffULL, 0x000000ff003fffffULL, 0x07fdffffffffffbfULL, 0x91bffffffffffd3fULL,
+            0xfe7fffffff3fffffULL, 0x0000ff807fffffffULL, 0xf837ffff00000000ULL, 0x03ffffff0fffffffULL,
+            0xf0ffffffffffffffULL, 0x873ffffffeeff06fULL, 0x7fffffff000001ffULL, 0x00000000ffffffffULL,
+            0x0000f87ffffffeffULL, 0xff07ffffff3fffffULL, 0x0000fe000003ffffULL, 0x00000000000001ffULL,
+            0x0007ffffffffffffULL, 0xfc07ffffffffffffULL, 0x03ff00ffffffffffULL, 0xffffbe3fffffffffULL,
+            0x000000000000003fULL, 0x7fffffff00000000ULL, 0x00031bffffffffffULL, 0xf00000000000001cULL,
+            0xffff0000001fffffULL, 0xffff00000000003fULL, 0x007fffff00000fffULL, 0x803ffffffffc007fULL,
+            0x03ff01ffffff0004ULL, 0xffdfffffffffffffULL, 0x004fffffffff00f0ULL, 0x001ffffe17ffde1fULL,
+            0xc0fffffffffbffffULL, 0x0000000000000003ULL, 0xffff01ffbfffbd7fULL, 0x03ff07ffffffffffULL,
+            0xfbedfdfffff99fefULL, 0x001f1fcfe081399fULL, 0xffbfffffffff4bffULL, 0x00000006000ff7a5ULL,
+            0x00000003c3ff07ffULL, 0x0000000003ff00bfULL, 0xff3fffffffffffffULL, 0x000000003f000001ULL,
+            0x0000000003ff0011ULL, 0x0000000fffff03ffULL, 0x0fff0fffe7ffffffULL, 0x000000000000007fULL,
+            0x8007ffffffffffffULL, 0xf9bfffffff6ff27fULL, 0x0000000003ff000fULL, 0xfffffcff00000000ULL,
+            0x0000001bfcffffffULL, 0xffffffffffff0080ULL, 0xffff000023ffffffULL, 0x03ff0001ffffffffULL,
+            0xff7ffffffffffdffULL, 0xfffc1fffffff0001ULL, 0x007ffefffffcffffULL, 0xb47ffffffffffb7fULL,
+            0xfffffdbf03ff00ffULL, 0x000003ff01fb7fffULL, 0x007fffff00000000ULL, 0xc7fffffffffdffffULL,
+            0x0000000007ff0007ULL, 0x0001000000000000ULL, 0x00000000001fffffULL, 0x00007fffffffffffULL,
+            0x000000000000000fULL, 0x0001ffffffffffffULL, 0x0000ffffffffffffULL, 0xffffffff003fffffULL,
+            0x03ffffffffffffffULL, 0xffff03ff7fffffffULL, 0x001f3fffffff03ffULL, 0xe0fffffbfbff000fULL,
+            0x000000000000ffffULL, 0x03ff1fffffffffffULL, 0x00000000007fffffULL, 0xffffffffffff87ffULL,
+            0x00000000ffff80ffULL, 0x0003001b00000000ULL, 0x80000000003fffffULL, 0x6fef000000000000ULL,
+            0x00040007ffffffffULL, 0xffff00f000270000ULL, 0x0fffffffffffffffULL, 0x1fff07ffffffffffULL,
+            0x0000000063ff01ffULL, 0xf807e3e000000000ULL, 0x00003c0000000fe7ULL, 0x000000000000001cULL,
+            0x000fffff000fffffULL, 0x01ffffff00000000ULL, 0xffffffffffdfffffULL, 0xebffde64dfffffffULL,
+            0xffffffffffffffefULL, 0x7bffffffdfdfe7bfULL, 0xfffffffffffdfc5fULL, 0xffffff3fffffffffULL,
+            0xf7fffffff7fffffdULL, 0xffdfffffffdfffffULL, 0xffff7fffffff7fffULL, 0xfffffdfffffffdffULL,
+            0xffffffffffffcff7ULL, 0xf87fffffffffffffULL, 0x00201fffffffffffULL, 0x0000fffef8000010ULL,
+            0x000007e07fffffffULL, 0xffff07dbf9ffff7fULL, 0x0000000000008000ULL, 0x3fff1fffffffffffULL,
+            0x00000000000043ffULL, 0x00007fffffff0000ULL, 0x03ffffffffff0000ULL, 0x07ffffffffff0000ULL,
+            0x7fff6f7f00000000ULL, 0x00000000007fff9fULL, 0x0000000003ff0fffULL, 0xfffe000000000000ULL,
+            0x001eefffffffffffULL, 0x3fffbffffffffffeULL, 0x0af7fe96ffffffefULL, 0x5ef7f796aa96ea84ULL,
+            0x0ffffbee0ffffbffULL, 0xffff0003ffffffffULL, 0xffff0001ffffffffULL, 0x000000003fffffffULL,
+            0xffffffffffff07ffULL,
+        }},
+    };
+
+    static inline constexpr PropertyTable<5, 6> whitespace_table{
+        {{
+            0, 1, 1, 1, 1, 2, 1, 1, 3, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        }},
+        {{
+            0, 1, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2,
+            4, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        }},
+        {{
+            0x00000001ffffffffULL, 0x8000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL,
+            0x00008300000007ffULL, 0x0000000080000000ULL,
+        }},
+    };
+
     // =========================================================================
     // Classification functions
     // =========================================================================
 
     namespace detail {
         /// Binary search: true if cp is in any of the sorted non-overlapping ranges.
+        /// The classifiers use the lookup tables; this is the reference they are
+        /// verified against.
         ///
         /// Pre:  ranges is sorted by `first` and non-overlapping
         ///       (guaranteed by the static_assert blocks at each table definition).
@@ -673,14 +1263,14 @@ namespace jsv::unicode {
     /// ASCII fast-path: [A-Za-z]
     [[nodiscard]] constexpr bool is_letter(char32_t cp) noexcept {
         if(cp < 0x80U) [[likely]] { return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z'); }
-        return detail::in_ranges(cp, letter_ranges);
+        return letter_table.contains(cp);
     }
 
     /// True if cp may start an identifier: \p{Letter} or '_' (U+005F).
     /// ASCII fast-path: [A-Za-z_]
     [[nodiscard]] constexpr bool is_id_start(char32_t cp) noexcept {
         if(cp < 0x80U) [[likely]] { return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z') || cp == U'_'; }
-        return detail::in_ranges(cp, id_start_ranges);
+        return id_start_table.contains(cp);
     }
 
     /// True if cp may continue an identifier:
@@ -690,7 +1280,7 @@ namespace jsv::unicode {
         if(cp < 0x80U) [[likely]] {
             return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z') || (cp >= U'0' && cp <= U'9') || cp == U'_';
         }
-        return detail::in_ranges(cp, id_continue_ranges);
+        return id_continue_table.contains(cp);
     }
 
     /// True if cp is a Unicode line terminator: NEL (U+0085), LINE SEPARATOR (U+2028),
@@ -709,7 +1299,7 @@ namespace jsv::unicode {
         if(cp < 0x80U) { return false; }            // Other ASCII not in Zs/Zl/Zp
         // Line terminators (U+0085, U+2028, U+2029) are whitespace even if not in Zs/Zl/Zp ranges
         if(is_unicode_line_terminator(cp)) { return true; }
-        return detail::in_ranges(cp, whitespace_ranges);
+        return whitespace_table.contains(cp);
     }
 }  // namespace jsv::unicode
 
@@ -6,8 +6,11 @@
 
 #pragma once
 
+#include "../simd/ByteScan.hpp"
 #include <cstdint>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace jsv::unicode {
 
@@ -26,6 +29,29 @@ namespace jsv::unicode {
         InvalidLeadByte,       ///< Byte 0xF5–0xFF (never valid in UTF-8)
     };
 
+    /// Byte range [begin, end) of a buffer that is not well-formed UTF-8.
+    struct Utf8Range {
+        std::size_t begin;
+        std::size_t end;
+
+        [[nodiscard]] constexpr bool operator==(const Utf8Range &) const noexcept = default;
+    };
+
+    /// Result of a whole-buffer `validate_utf8` pass.
+    ///
+    /// `invalid` holds, in order and merged when adjacent, the maximal subparts
+    /// that `decode_utf8` reports as errors when the buffer is decoded sequence
+    /// by sequence from offset 0. Every ASCII or lead byte outside those ranges
+    /// therefore starts a well-formed sequence.
+    struct Utf8Validation {
+        std::vector<Utf8Range> invalid;
+
+        [[nodiscard]] constexpr bool is_valid() const noexcept { return invalid.empty(); }
+
+        /// Whether no invalid range intersects [begin, end).
+        [[nodiscard]] constexpr bool is_valid_range(std::size_t begin, std::size_t end) const noexcept;
+    };
+
     /// Result of decoding one UTF-8 sequence.
     struct Utf8DecodeResult {
         char32_t codepoint;        ///< Decoded code point; U+FFFD on any error
@@ -73,6 +99,28 @@ namespace jsv::unicode {
     /// Equivalent to: decode_utf8(input, offset).status == Utf8Status::Ok
     [[nodiscard]] constexpr bool is_valid_utf8_at(std::string_view input, std::size_t offset) noexcept;
 
+    /// Validate a whole run of bytes at once.
+    /// Equivalent to decoding `input` sequence by sequence from offset 0 and
+    /// checking that every status is Ok; a sequence cut short by the end of the
+    /// view counts as truncated. ASCII bytes are skipped eight at a time.
+    [[nodiscard]] constexpr bool is_valid_utf8(std::string_view input) noexcept;
+
+    /// Decode the sequence at input[offset] without any validation.
+    /// Precondition: a well-formed sequence starts at input[offset], e.g. a
+    /// non-continuation byte outside the invalid ranges of `validate_utf8`.
+    [[nodiscard]] constexpr Utf8DecodeResult decode_utf8_unchecked(std::string_view input, std::size_t offset) noexcept;
+
+    /// Encode the scalar value `codepoint` as UTF-8 into `out`, which must
+    /// have room for 4 bytes. Returns the number of bytes written.
+    /// Precondition: `codepoint` is at most U+10FFFF and not a surrogate.
+    [[nodiscard]] constexpr std::size_t encode_utf8(char32_t codepoint, char *out) noexcept;
+
+    /// Validate a whole buffer once and record where it is not UTF-8.
+    /// Uses the lookup-table algorithm (Keiser & Lemire) 32 bytes per step on
+    /// AVX2 targets; blocks flagged there are re-walked with `decode_utf8` to
+    /// find the exact ranges. Other targets use `detail::validate_utf8_scalar`.
+    [[nodiscard]] inline Utf8Validation validate_utf8(std::string_view input);
+
     // =========================================================================
     // Inline implementations (constexpr functions must be defined in headers)
     // =========================================================================
@@ -265,6 +313,256 @@ namespace jsv::unicode {
         return decode_utf8(input, offset).status == Utf8Status::Ok;
     }
 
+    [[nodiscard]] constexpr bool is_valid_utf8(std::string_view input) noexcept {
+        constexpr std::size_t word = 8;
+        std::size_t offset = 0;
+        while(offset < input.size()) {
+            // PERF: an all-ASCII word is valid as a whole — no per-byte decode.
+            if(offset + word <= input.size()) {
+                bool ascii = true;
+                for(std::size_t i = 0; i < word; ++i) { ascii = ascii && C_UI8T(input[offset + i]) <= detail::ASCII_MAX; }
+                if(ascii) {
+                    offset += word;
+                    continue;
+                }
+            }
+            if(C_UI8T(input[offset]) <= detail::ASCII_MAX) {
+                ++offset;
+                continue;
+            }
+            const auto res = decode_utf8(input, offset);
+            if(res.status != Utf8Status::Ok) { return false; }
+            offset += res.byte_length;
+        }
+        return true;
+    }
+
+    [[nodiscard]] constexpr bool Utf8Validation::is_valid_range(const std::size_t begin, const std::size_t end) const noexcept {
+        if(invalid.empty()) { return true; }
+        // First range ending after `begin`; it intersects iff it starts before `end`.
+        const auto it = std::ranges::upper_bound(invalid, begin, {}, &Utf8Range::end);
+        return it == invalid.end() || it->begin >= end;
+    }
+
+    [[nodiscard]] constexpr Utf8DecodeResult decode_utf8_unchecked(std::string_view input, std::size_t offset) noexcept {
+        const auto b0 = C_UI8T(input[offset]);
+        if(b0 <= detail::ASCII_MAX) [[likely]] { return {static_cast<char32_t>(b0), 1, Utf8Status::Ok}; }
+        const auto b1 = C_UI8T(input[offset + 1]);
+        if(b0 < detail::LEAD_3BYTE_MIN) {
+            return {C_C32(((b0 & detail::LEAD_2BYTE_PAYLOAD_MASK) << detail::SHIFT_2BYTE) | (b1 & detail::PAYLOAD_MASK)), 2, Utf8Status::Ok};
+        }
+        const auto b2 = C_UI8T(input[offset + 2]);
+        if(b0 < detail::LEAD_4BYTE_MIN) {
+            return {C_C32(((b0 & detail::LEAD_3BYTE_PAYLOAD_MASK) << detail::SHIFT_3BYTE) | ((b1 & detail::PAYLOAD_MASK) << detail::SHIFT_2BYTE) |
+                          (b2 & detail::PAYLOAD_MASK)),
+                    3, Utf8Status::Ok};
+        }
+        const auto b3 = C_UI8T(input[offset + 3]);
+        return {C_C32(((b0 & detail::LEAD_4BYTE_PAYLOAD_MASK) << detail::SHIFT_4BYTE) | ((b1 & detail::PAYLOAD_MASK) << detail::SHIFT_3BYTE) |
+                      ((b2 & detail::PAYLOAD_MASK) << detail::SHIFT_2BYTE) | (b3 & detail::PAYLOAD_MASK)),
+                4, Utf8Status::Ok};
+    }
+
+    [[nodiscard]] constexpr std::size_t encode_utf8(const char32_t codepoint, char *out) noexcept {
+        const auto cp = C_UI32T(codepoint);
+        if(cp <= detail::ASCII_MAX) {
+            out[0] = C_C(cp);
+            return 1;
+        }
+        const auto continuation = [](const std::uint32_t bits) { return C_C(detail::CONT_TAG | (bits & detail::PAYLOAD_MASK)); };
+        if(cp < 0x800) {
+            out[0] = C_C(0xC0U | (cp >> detail::SHIFT_2BYTE));
+            out[1] = continuation(cp);
+            return 2;
+        }
+        if(cp < 0x10000) {
+            out[0] = C_C(detail::LEAD_3BYTE_MIN | (cp >> detail::SHIFT_3BYTE));
+            out[1] = continuation(cp >> detail::SHIFT_2BYTE);
+            out[2] = continuation(cp);
+            return 3;
+        }
+        out[0] = C_C(detail::LEAD_4BYTE_MIN | (cp >> detail::SHIFT_4BYTE));
+        out[1] = continuation(cp >> detail::SHIFT_3BYTE);
+        out[2] = continuation(cp >> detail::SHIFT_2BYTE);
+        out[3] = continuation(cp);
+        return 4;
+    }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    // validate_utf8 — whole-buffer pass
+    // ─────────────────────────────────────────────────────────────────────────
+
+    namespace detail {
+
+        /// Append [begin, end) to `ranges`, merging it with an adjacent last range.
+        constexpr void add_invalid_range(std::vector<Utf8Range> &ranges, const std::size_t begin, const std::size_t end) {
+            if(!ranges.empty() && ranges.back().end == begin) {
+                ranges.back().end = end;
+            } else {
+                ranges.push_back({begin, end});
+            }
+        }
+
+        /// Decode sequences from boundary `pos` until `last` is reached,
+        /// recording every error. Returns the boundary where decoding stopped.
+        constexpr std::size_t walk_utf8(std::string_view input, std::size_t pos, const std::size_t last, std::vector<Utf8Range> &ranges) {
+            while(pos < last) {
+                if(C_UI8T(input[pos]) <= ASCII_MAX) {
+                    ++pos;
+                    continue;
+                }
+                const auto res = decode_utf8(input, pos);
+                if(res.status != Utf8Status::Ok) { add_invalid_range(ranges, pos, pos + res.byte_length); }
+                pos += res.byte_length;
+            }
+            return pos;
+        }
+
+        /// Scalar reference for `validate_utf8`.
+        [[nodiscard]] constexpr Utf8Validation validate_utf8_scalar(std::string_view input) {
+            Utf8Validation res;
+            walk_utf8(input, 0, input.size(), res.invalid);
+            return res;
+        }
+
+#ifdef JSV_SIMD_AVX2
+        // Error bits of the lookup tables: each class of ill-formed byte pair
+        // sets one bit in all three tables, so the AND of the lookups is
+        // non-zero exactly for the bad pairs.
+        inline constexpr std::uint8_t TOO_SHORT = 1U << 0U;       ///< Lead byte followed by a non-continuation
+        inline constexpr std::uint8_t TOO_LONG = 1U << 1U;        ///< ASCII followed by a continuation
+        inline constexpr std::uint8_t OVERLONG_3 = 1U << 2U;      ///< E0 80..9F
+        inline constexpr std::uint8_t TOO_LARGE = 1U << 3U;       ///< F4 90..BF, F5..FF
+        inline constexpr std::uint8_t SURROGATE = 1U << 4U;       ///< ED A0..BF
+        inline constexpr std::uint8_t OVERLONG_2 = 1U << 5U;      ///< C0..C1
+        inline constexpr std::uint8_t TOO_LARGE_1000 = 1U << 6U;  ///< F5..FF 80..8F
+        inline constexpr std::uint8_t OVERLONG_4 = 1U << 6U;      ///< F0 80..8F
+        inline constexpr std::uint8_t TWO_CONTS = 1U << 7U;       ///< Continuation after continuation
+        inline constexpr std::uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        /// `_mm256_shuffle_epi8` table with the same 16 entries in both lanes.
+        [[nodiscard]] inline __m256i utf8_table(const std::array<std::uint8_t, 16> &t) noexcept {
+            const auto c = [&t](const std::size_t i) { return static_cast<char>(t[i]); };
+            return _mm256_setr_epi8(c(0), c(1), c(2), c(3), c(4), c(5), c(6), c(7), c(8), c(9), c(10), c(11), c(12), c(13), c(14), c(15),
+                                    c(0), c(1), c(2), c(3), c(4), c(5), c(6), c(7), c(8), c(9), c(10), c(11), c(12), c(13), c(14), c(15));
+        }
+
+        /// `input` shifted by N bytes towards the end, the gap filled from `prev`.
+        template <int N> [[nodiscard]] inline __m256i utf8_prev(const __m256i input, const __m256i prev) noexcept {
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev, input, 0x21), 16 - N);
+        }
+
+        /// Lookup-table error mask of one 32-byte block; zero when well-formed
+        /// given the previous block `prev`.
+        [[nodiscard]] inline __m256i utf8_block_errors(const __m256i input, const __m256i prev) noexcept {
+            static constexpr std::array<std::uint8_t, 16> byte_1_high{
+                TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,  // 0___
+                TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,                                      // 10__
+                TOO_SHORT | OVERLONG_2,                                                          // 1100
+                TOO_SHORT,                                                                       // 1101
+                TOO_SHORT | OVERLONG_3 | SURROGATE,                                              // 1110
+                TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4};                            // 1111
+            static constexpr std::uint8_t large = CARRY | TOO_LARGE | TOO_LARGE_1000;
+            static constexpr std::array<std::uint8_t, 16> byte_1_low{
+                CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, CARRY | OVERLONG_2, CARRY, CARRY, CARRY | TOO_LARGE, large, large, large,
+                large, large, large, large, large, large | SURROGATE, large, large};
+            static constexpr std::uint8_t cont_low = TOO_LONG | OVERLONG_2 | TWO_CONTS;
+            static constexpr std::array<std::uint8_t, 16> byte_2_high{
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,  // 0___
+                cont_low | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,                                    // 1000
+                cont_low | OVERLONG_3 | TOO_LARGE,                                                      // 1001
+                cont_low | SURROGATE | TOO_LARGE, cont_low | SURROGATE | TOO_LARGE,                     // 101_
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT};                                            // 11__
+
+            const auto nibble = _mm256_set1_epi8(0x0F);
+            const auto prev1 = utf8_prev<1>(input, prev);
+            const auto special = _mm256_and_si256(
+                _mm256_and_si256(_mm256_shuffle_epi8(utf8_table(byte_1_high), _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+                                 _mm256_shuffle_epi8(utf8_table(byte_1_low), _mm256_and_si256(prev1, nibble))),
+                _mm256_shuffle_epi8(utf8_table(byte_2_high), _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+            // Third and fourth bytes of 3/4-byte sequences must be continuations:
+            // those are exactly the TWO_CONTS pairs that are not errors.
+            const auto third = _mm256_subs_epu8(utf8_prev<2>(input, prev), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+            const auto fourth = _mm256_subs_epu8(utf8_prev<3>(input, prev), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+            const auto must_be_cont = _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+            return _mm256_xor_si256(must_be_cont, special);
+        }
+
+        /// Non-zero when the block ends inside a sequence (checked against the
+        /// next block only when that one is pure ASCII).
+        [[nodiscard]] inline __m256i utf8_block_incomplete(const __m256i input) noexcept {
+            const auto max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1),
+                                              static_cast<char>(0xC0 - 1));
+            return _mm256_subs_epu8(input, max);
+        }
+
+        [[nodiscard]] inline Utf8Validation validate_utf8_avx2(std::string_view input) {
+            static constexpr std::size_t block = 32;
+            Utf8Validation res;
+            const auto size = input.size();
+            auto prev = _mm256_setzero_si256();
+            auto incomplete = _mm256_setzero_si256();
+            std::size_t pos = 0;
+            std::size_t boundary = 0;  ///< Where the last re-walk stopped.
+            bool tail_done = false;
+            while(!tail_done) {
+                __m256i in;
+                std::size_t block_end = pos + block;
+                if(block_end <= size) {
+                    in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input.data() + pos));
+                } else {
+                    // Zero padding: a sequence cut by the end of the buffer
+                    // fails against the padding like against ASCII.
+                    std::array<char, block> padded{};
+                    std::ranges::copy(input.substr(pos), padded.begin());
+                    in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(padded.data()));
+                    block_end = size;
+                    tail_done = true;
+                }
+                __m256i errors;
+                if(_mm256_movemask_epi8(in) == 0) {
+                    errors = incomplete;
+                } else {
+                    errors = utf8_block_errors(in, prev);
+                    incomplete = utf8_block_incomplete(in);
+                }
+                if(_mm256_testz_si256(errors, errors) == 0) [[unlikely]] {
+                    // Re-walk from the last sequence start before the block,
+                    // then restart the vector scan on the boundary reached.
+                    auto start = pos;
+                    for(std::size_t k = 1; k <= 3 && pos - k + 1 > boundary; ++k) {
+                        if(!is_continuation(C_UI8T(input[pos - k]))) {
+                            start = pos - k;
+                            break;
+                        }
+                    }
+                    pos = walk_utf8(input, start, block_end, res.invalid);
+                    boundary = pos;
+                    prev = _mm256_setzero_si256();
+                    incomplete = _mm256_setzero_si256();
+                    tail_done = tail_done && pos >= size;
+                    continue;
+                }
+                if(!tail_done) {
+                    prev = in;
+                    pos = block_end;
+                }
+            }
+            return res;
+        }
+#endif
+
+    }  // namespace detail
+
+    [[nodiscard]] inline Utf8Validation validate_utf8(std::string_view input) {
+#ifdef JSV_SIMD_AVX2
+        return detail::validate_utf8_avx2(input);
+#else
+        return detail::validate_utf8_scalar(input);
+#endif
+    }
+
 }  // namespace jsv::unicode
 
 // NOLINTEND(*-magic-numbers, *-avoid-magic-numbers)
\ No newline at end of file
@@ -38,16 +38,16 @@ namespace vnd {
      * @details This function reads the entire contents of the specified file into
      *          a std::string. It performs the following operations:
      *          1. Validates that the path exists and is a regular file
-     *          2. Acquires a mutex lock for thread safety
-     *          3. Optionally measures read performance with a timer (INDEPT mode)
-     *          4. Pre-allocates the string buffer based on file size
-     *          5. Reads the file contents in binary mode
-     *          6. Handles various error conditions with descriptive exceptions
+     *          2. Optionally measures read performance with a timer (INDEPT mode)
+     *          3. Pre-allocates the string buffer based on file size
+     *          4. Reads the file contents in binary mode
+     *          5. Handles various error conditions with descriptive exceptions
      *
      * @throws FileReadError If the file does not exist, is not a regular file,
      *         cannot be opened, or an I/O error occurs during reading.
      *
-     * @note Thread-safe: concurrent calls are serialized via a function-local mutex.
+     * @note Thread-safe: calls share no state, so reads of different files run
+     *       concurrently. To load many files at once, see SourceBuffer::from_files.
      * @note In INDEPT mode, an AutoTimer measures and logs the read performance.
      * @note If the file is truncated between stat and read, only the bytes actually
      *       read are returned.
@@ -55,8 +55,6 @@ namespace vnd {
      * @see openFile
      */
     inline auto readFromFile(const std::string_view filename) -> std::string {
-        static std::mutex fileReadMutex;
-        const std::scoped_lock lock(fileReadMutex);  // Ensure thread safety
         const fs::path filePath(filename);
         const auto status = fs::status(filePath);
         if(!fs::exists(status)) { throw FILEREADEREERRORF("File not found: {}", filePath.string()); }
@@ -79,7 +77,7 @@ namespace vnd {
             // CORRECTNESS: explicit cast to std::streamsize avoids implicit narrowing
             // from std::size_t (unsigned 64-bit) on platforms where std::streamsize
             // is signed 64-bit. Values up to 2^63-1 are safe; larger files would
-            // require chunked reading (out of scope for this utility).
+            // require chunked reading, as jsv::StreamingLexer does.
             fileStream.read(content.data(), static_cast<std::streamsize>(fileSize));
 
             // Defensive resize: handles file truncation between stat and read.
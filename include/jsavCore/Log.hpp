@@ -231,6 +231,9 @@ inline void my_error_handler(const std::string& msg) {
 }
 // clang-format on
 
+/// @brief Pattern of every log line: "[HH:MM:SS level] message", colored by level.
+inline constexpr const char *log_pattern = R"(%^[%T %l] %v%$)";
+
 /**
  * @brief Sets up the default logger with console sinks.
  *
@@ -266,13 +269,37 @@ inline void setup_logger() {
 
     // Create logger with the defined sinks
     const auto logger = std::make_shared<spdlog::logger>("main", sinks.begin(), sinks.end());
-    logger->set_pattern(R"(%^[%T %l] %v%$)");  // Log pattern
+    logger->set_pattern(log_pattern);          // Log pattern
     logger->set_level(spdlog::level::trace);   // Minimum log level (trace)
 
     // Set this logger as the default logger
     spdlog::set_default_logger(logger);
 }
 
+/**
+ * @brief Sends every log level of the default logger to stderr.
+ *
+ * @details Replaces the sinks set up by setup_logger() with one colored stderr
+ *          sink that accepts all levels, so stdout carries only program output,
+ *          e.g. a token dump that log lines must not interleave with.
+ *
+ * @pre setup_logger() has run, and no other thread is logging yet.
+ *
+ * @par Example:
+ * @code{.cpp}
+ * INIT_LOG();
+ * log_to_stderr();
+ * LINFO("Goes to stderr");
+ * @endcode
+ */
+inline void log_to_stderr() {
+    const auto stderr_sink = std::make_shared<spdlog::sinks::stderr_color_sink_mt>();
+    stderr_sink->set_level(spdlog::level::trace);  // Log all levels (trace and above)
+    const auto logger = spdlog::default_logger();
+    logger->sinks().assign(1, stderr_sink);
+    logger->set_pattern(log_pattern);
+}
+
 /**
  * @brief Initialize the logging system with default configurations.
  *
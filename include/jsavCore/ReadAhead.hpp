@@ -0,0 +1,104 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "FileReaderError.hpp"
+#include "format.hpp"
+#include "headersCore.hpp"
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace vnd {
+
+    /**
+     * @brief Reads an input ahead of its consumer on a background thread.
+     *
+     * @details A reader thread fills a ring of `chunks` buffers of `chunk_bytes`
+     *          each, in order, while the consumer drains completed chunks with
+     *          `read`. Up to `chunks` chunks are in flight, so I/O latency (a
+     *          cold page cache, a network filesystem) overlaps with whatever
+     *          the consumer does with the data already read. Memory is bounded
+     *          by `chunks * chunk_bytes`.
+     *
+     *          An exception thrown by the source is rethrown by `read` once the
+     *          chunks read before it have been consumed. Only one thread may
+     *          call `read`.
+     *
+     * @par Example:
+     * @code{.cpp}
+     * const auto ahead = vnd::ReadAhead::from_file("main.vn");
+     * jsv::StreamingLexer lexer{[&](char *buffer, std::size_t size) { return ahead->read(buffer, size); }, "main.vn"};
+     * @endcode
+     */
+    class ReadAhead {
+    public:
+        /// Reads up to `size` bytes into `buffer`, returning 0 at end of input.
+        using Source = std::function<std::size_t(char *buffer, std::size_t size)>;
+
+        /// Start reading `source` on a background thread.
+        explicit ReadAhead(Source source, std::size_t chunk_bytes = std::size_t{1} << 20U, std::size_t chunks = 4);
+
+        /**
+         * @brief Read the file at `filename` ahead.
+         *
+         * @throws FileReadError If the path does not exist, is a directory or
+         *         cannot be opened. Read errors surface from `read`.
+         */
+        [[nodiscard]] static std::unique_ptr<ReadAhead> from_file(std::string_view filename, std::size_t chunk_bytes = std::size_t{1} << 20U,
+                                                                  std::size_t chunks = 4);
+
+        ReadAhead(const ReadAhead &) = delete;
+        ReadAhead &operator=(const ReadAhead &) = delete;
+        ReadAhead(ReadAhead &&) = delete;
+        ReadAhead &operator=(ReadAhead &&) = delete;
+        /// Stops the reader thread after its current read and joins it.
+        ~ReadAhead() = default;
+
+        /**
+         * @brief Copies up to `size` bytes of the oldest completed chunk into `buffer`.
+         *
+         * @details Blocks until a chunk is complete; never returns bytes of more
+         *          than one chunk, so the consumer can start on the first chunk
+         *          while the next is still being read.
+         *
+         * @return Bytes copied; 0 once the whole input has been consumed.
+         * @throws Whatever the source threw, after the chunks read before it.
+         */
+        std::size_t read(char *buffer, std::size_t size);
+
+        /// Bytes handed out by `read` so far.
+        [[nodiscard]] std::size_t consumed() const noexcept { return m_consumed; }
+
+    private:
+        struct Chunk {
+            std::unique_ptr<char[]> data;  // NOLINT(*-avoid-c-arrays)
+            std::size_t size = 0;
+        };
+
+        void produce(const std::stop_token &stop);
+
+        Source m_source;
+        std::size_t m_chunk_bytes;
+        std::vector<Chunk> m_ring;
+        std::size_t m_head = 0;     ///< Oldest completed chunk (consumer side).
+        std::size_t m_offset = 0;   ///< Bytes of the head chunk already consumed.
+        std::size_t m_filled = 0;   ///< Completed chunks not yet fully consumed.
+        std::size_t m_consumed = 0;
+        bool m_done = false;        ///< The source is exhausted or threw.
+        std::exception_ptr m_error;
+        std::mutex m_mutex;
+        std::condition_variable m_ready;     ///< A chunk was completed, or `m_done` set.
+        std::condition_variable_any m_free;  ///< A chunk was released (or stop requested).
+        /// Declared last, so it is stopped and joined before anything it uses
+        /// is destroyed.
+        std::jthread m_reader;
+    };
+
+}  // namespace vnd
+
+// NOLINTEND(*-include-cleaner)
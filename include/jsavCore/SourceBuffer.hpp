@@ -0,0 +1,104 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner)
+#pragma once
+
+#include "FileReaderError.hpp"
+#include "format.hpp"
+#include "headersCore.hpp"
+#include <expected>
+#include <span>
+
+namespace vnd {
+
+    /**
+     * @brief Read-only source text followed by at least `padding` zero bytes.
+     *
+     * @details Regular files are memory-mapped read-only, so a large input
+     *          costs neither a heap copy nor a second copy of the page cache.
+     *          Pipes, character devices and other non-seekable inputs are read
+     *          into a heap buffer instead. Either way the `padding` bytes past
+     *          `size()` are readable and zero, so block scanners may load a
+     *          full vector past the end of the text without a bounds check.
+     *
+     *          The buffer is move-only; `text()` stays valid until it is
+     *          destroyed or moved from.
+     *
+     * @par Example:
+     * @code{.cpp}
+     * const auto source = vnd::SourceBuffer::from_file("main.vn");
+     * jsv::Lexer lexer{source, "main.vn"};
+     * @endcode
+     */
+    class SourceBuffer;
+
+    /// A loaded buffer, or the error that `SourceBuffer::from_file` would have thrown.
+    using SourceBufferResult = std::expected<SourceBuffer, FileReadError>;
+
+    class SourceBuffer {
+    public:
+        /// Zero bytes guaranteed readable after the last byte of text.
+        static constexpr std::size_t padding = 64;
+
+        /// Empty text, still followed by `padding` zero bytes.
+        SourceBuffer() noexcept;
+        SourceBuffer(const SourceBuffer &) = delete;
+        SourceBuffer &operator=(const SourceBuffer &) = delete;
+        SourceBuffer(SourceBuffer &&other) noexcept;
+        SourceBuffer &operator=(SourceBuffer &&other) noexcept;
+        ~SourceBuffer();
+
+        /**
+         * @brief Loads the file at `filename`, mapping it when it is a regular file.
+         *
+         * @throws FileReadError If the path does not exist, is a directory,
+         *         cannot be opened, or an I/O error occurs while reading it.
+         */
+        [[nodiscard]] static SourceBuffer from_file(std::string_view filename);
+
+        /// `from_file` reporting failures as a value instead of throwing.
+        [[nodiscard]] static SourceBufferResult try_from_file(std::string_view filename);
+
+        /**
+         * @brief Loads every file in `filenames` concurrently.
+         *
+         * @details Files are handed out to `threads` workers (0: one per
+         *          hardware thread, never more than there are files). Reads
+         *          share no lock, so independent files load in parallel and a
+         *          large batch is bound by disk bandwidth. One failed file does
+         *          not affect the others.
+         *
+         * @return One result per path, in the order of `filenames`.
+         */
+        [[nodiscard]] static std::vector<SourceBufferResult> from_files(std::span<const std::string> filenames, std::size_t threads = 0);
+
+        /// Padded heap copy of `text`, for sources that do not come from a file.
+        [[nodiscard]] static SourceBuffer copy_of(std::string_view text);
+
+        [[nodiscard]] std::string_view text() const noexcept { return {m_data, m_size}; }
+        [[nodiscard]] const char *data() const noexcept { return m_data; }
+        [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+        /// True when the text is a view of a file mapping rather than a heap copy.
+        [[nodiscard]] bool is_mapped() const noexcept { return m_mapped_size != 0; }
+
+        // NOLINTNEXTLINE(*-explicit-constructor, *-explicit-conversions)
+        operator std::string_view() const noexcept { return text(); }
+
+    private:
+        void release() noexcept;
+
+        /// Heap buffer of `size + padding` bytes, padding zeroed; the caller fills the text.
+        [[nodiscard]] static SourceBuffer allocate(std::size_t size);
+
+        const char *m_data;
+        std::size_t m_size = 0;
+        std::size_t m_mapped_size = 0;  ///< Length of the mapping at `m_data`, 0 for heap buffers.
+        std::unique_ptr<char[]> m_heap;
+    };
+
+}  // namespace vnd
+
+// NOLINTEND(*-include-cleaner)
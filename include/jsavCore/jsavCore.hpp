@@ -6,4 +6,6 @@
 
 #include "FileReader.hpp"
 #include "Log.hpp"
+#include "ReadAhead.hpp"
+#include "SourceBuffer.hpp"
 #include "headersCore.hpp"
@@ -2,21 +2,25 @@
 """
 generate_unicode_tables.py — Offline generator for jsav lexer Unicode lookup tables.
 
-Downloads UnicodeData.txt for Unicode 16.0.0, parses General Categories,
-merges adjacent ranges for id_start / id_continue / whitespace classifiers,
-and outputs a formatted constexpr C++ header.
+Downloads UnicodeData.txt for Unicode 16.0.0 (or reads a local copy), parses
+General Categories, merges adjacent ranges for id_start / id_continue / whitespace
+classifiers, compresses each classifier into a three-stage lookup table, and
+outputs a formatted constexpr C++ header.
 
 SC-005 conformance: After generating tables, re-parses the generated C++ ranges and
 verifies 100% round-trip coverage against UnicodeData.txt for categories L, M, N, Zs,
-Zl, Zp.  Exits non-zero on any mismatch.
+Zl, Zp, then checks that every lookup table agrees with its ranges on all code
+points.  Exits non-zero on any mismatch.
 
 Usage:
     python scripts/generate_unicode_tables.py
+    python scripts/generate_unicode_tables.py --unicode-data path/to/UnicodeData.txt
 
 Output:
     include/jsav/lexer/unicode/UnicodeData.hpp
 """
 
+import argparse
 from bisect import bisect_right
 from itertools import batched
 import shutil
@@ -65,6 +69,15 @@ WHITESPACE_CATEGORIES = frozenset({"Zs", "Zl", "Zp", "Cc"})
 # "Letter" for is_letter() — all L categories
 LETTER_CATEGORIES = frozenset({"Lu", "Ll", "Lt", "Lm", "Lo"})
 
+# Three-stage lookup layout: stage 1 is indexed by cp >> BLOCK_SHIFT and picks a
+# block of leaf indices, stage 2 is indexed by (cp >> LEAF_SHIFT) within the block
+# and picks a 64-bit leaf bitmap, and bit (cp & 63) of the leaf is the property.
+MAX_CODEPOINT = 0x10FFFF
+LEAF_SHIFT = 6
+BLOCK_SHIFT = 10
+LEAVES_PER_BLOCK = 1 << (BLOCK_SHIFT - LEAF_SHIFT)
+STAGE1_SIZE = (MAX_CODEPOINT + 1) >> BLOCK_SHIFT
+
 def format_size(bytes: int) -> tuple[float, str]:
     size = float(bytes)
     unit = 0
@@ -200,6 +213,15 @@ def download_unicode_data() -> str:
     return data
 
 
+def read_unicode_data(path: Path) -> str:
+    """Read a local UnicodeData.txt, for offline regeneration."""
+    print(f"Reading {path}...")
+    data = path.read_text(encoding="utf-8")
+    size, unit = format_size(len(data))
+    print(f"  Read {size:.2f} {unit} ({len(data):,} bytes).")
+    return data
+
+
 def parse_codepoints(data: str) -> dict[int, str]:
     """Return {codepoint: general_category} mapping.
 
@@ -293,6 +315,71 @@ def build_ranges(
     return ranges
 
 
+# -----------------------------------------------------------------------------
+# Build three-stage lookup tables
+# -----------------------------------------------------------------------------
+
+def ranges_to_bitmap(ranges: list[tuple[int, int]]) -> bytearray:
+    """One byte per code point: 1 if it lies in one of the ranges."""
+    bits = bytearray(MAX_CODEPOINT + 1)
+    for first, last in ranges:
+        bits[first:last + 1] = b"\x01" * (last - first + 1)
+    return bits
+
+
+def build_stage_tables(
+        ranges: list[tuple[int, int]]
+) -> tuple[list[int], list[int], list[int]]:
+    """Compress ranges into (stage1, stage2, leaves), sharing identical blocks and leaves."""
+    bits = ranges_to_bitmap(ranges)
+
+    leaves: dict[int, int] = {}
+    leaf_index: list[int] = []
+    for base in range(0, MAX_CODEPOINT + 1, 64):
+        # Bit i of the leaf is code point base + i.
+        word = sum(1 << i for i, b in enumerate(bits[base:base + 64]) if b)
+        leaf_index.append(leaves.setdefault(word, len(leaves)))
+
+    blocks: dict[tuple[int, ...], int] = {}
+    stage1: list[int] = []
+    for start in range(0, len(leaf_index), LEAVES_PER_BLOCK):
+        block = tuple(leaf_index[start:start + LEAVES_PER_BLOCK])
+        stage1.append(blocks.setdefault(block, len(blocks)))
+
+    if len(blocks) > 0x100 or len(leaves) > 0x10000:
+        print(f"  Stage tables overflow their index types: {len(blocks)} blocks, {len(leaves)} leaves")
+        sys.exit(1)
+    stage2 = [leaf for block in blocks for leaf in block]
+    return stage1, stage2, list(leaves)
+
+
+def stage_lookup(tables: tuple[list[int], list[int], list[int]], cp: int) -> bool:
+    """Python mirror of PropertyTable::contains."""
+    stage1, stage2, leaves = tables
+    block = stage1[cp >> BLOCK_SHIFT]
+    leaf = stage2[block * LEAVES_PER_BLOCK + ((cp >> LEAF_SHIFT) & (LEAVES_PER_BLOCK - 1))]
+    return (leaves[leaf] >> (cp & 63)) & 1 == 1
+
+
+def validate_stage_tables(
+        generated_ranges: dict[str, list[tuple[int, int]]],
+        generated_tables: dict[str, tuple[list[int], list[int], list[int]]],
+) -> None:
+    """Check every lookup table against its ranges on all code points. Exits non-zero on mismatch."""
+    print("Validating three-stage lookup tables...")
+    for name, ranges in generated_ranges.items():
+        bits = ranges_to_bitmap(ranges)
+        tables = generated_tables[name]
+        for cp in range(MAX_CODEPOINT + 1):
+            if stage_lookup(tables, cp) != (bits[cp] == 1):
+                print(f"  Lookup FAIL [{name}]: U+{cp:04X} disagrees with the range table")
+                sys.exit(1)
+        stage1, stage2, leaves = tables
+        table_bytes = len(stage1) + 2 * len(stage2) + 8 * len(leaves)
+        print(f"  Lookup PASS [{name}]: {len(stage2) // LEAVES_PER_BLOCK} blocks, {len(leaves)} leaves, {table_bytes:,} bytes")
+    print("Lookup table validation PASSED.\n")
+
+
 # -----------------------------------------------------------------------------
 # SC-005 Conformance Validation
 # -----------------------------------------------------------------------------
@@ -379,8 +466,30 @@ def format_ranges_cpp(ranges: list[tuple[int, int]], indent: str = "    ") -> st
     )
 
 
+def format_ints_cpp(values: list[int], per_line: int, fmt: str, indent: str = "        ") -> str:
+    """Format integers as a C++ initializer list body, `per_line` entries per line."""
+    return "\n".join(
+        indent + ", ".join(format(v, fmt) for v in batch) + ","
+        for batch in batched(values, per_line)
+    )
+
+
+def format_table_cpp(name: str, tables: tuple[list[int], list[int], list[int]]) -> str:
+    """Format one PropertyTable definition."""
+    stage1, stage2, leaves = tables
+    blocks = len(stage2) // LEAVES_PER_BLOCK
+    return (
+        f"    static inline constexpr PropertyTable<{blocks}, {len(leaves)}> {name}{{\n"
+        f"        {{{{\n{format_ints_cpp(stage1, 32, 'd', '            ')}\n        }}}},\n"
+        f"        {{{{\n{format_ints_cpp(stage2, 16, 'd', '            ')}\n        }}}},\n"
+        f"        {{{{\n{format_ints_cpp(leaves, 4, '#018x', '            ').replace(',', 'ULL,')}\n        }}}},\n"
+        f"    }};"
+    )
+
+
 def generate_header(
         generated_ranges: dict[str, list[tuple[int, int]]],
+        generated_tables: dict[str, tuple[list[int], list[int], list[int]]],
         unicode_version: str,
         generation_date: str,
 ) -> str:
@@ -394,6 +503,11 @@ def generate_header(
     id_continue_cpp = format_ranges_cpp(id_continue_ranges)
     whitespace_cpp  = format_ranges_cpp(whitespace_ranges)
 
+    letter_table_cpp      = format_table_cpp("letter_table", generated_tables["letter"])
+    id_start_table_cpp    = format_table_cpp("id_start_table", generated_tables["id_start"])
+    id_continue_table_cpp = format_table_cpp("id_continue_table", generated_tables["id_continue"])
+    whitespace_table_cpp  = format_table_cpp("whitespace_table", generated_tables["whitespace"])
+
     return f"""\
 /*
  * Generated by scripts/generate_unicode_tables.py
@@ -407,6 +521,7 @@ def generate_header(
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <span>
 
 namespace jsv::unicode {{
@@ -485,12 +600,44 @@ namespace jsv::unicode {{
         }}(),
         "whitespace_ranges must be sorted and non-overlapping (required for binary search)");
 
+    // =========================================================================
+    // Three-stage lookup tables — one per classifier, built from the ranges above
+    // =========================================================================
+
+    /// Bitmap of one property over all code points, compressed in three stages:
+    /// `stage1[cp >> {BLOCK_SHIFT}]` picks a block, `stage2[block * {LEAVES_PER_BLOCK} + ((cp >> {LEAF_SHIFT}) & {LEAVES_PER_BLOCK - 1})]`
+    /// picks a 64-bit leaf, and bit `cp & 63` of the leaf is the property.
+    /// Identical blocks and leaves are stored once.
+    template <std::size_t Blocks, std::size_t Leaves> struct PropertyTable {{
+        std::array<std::uint8_t, {STAGE1_SIZE}> stage1;
+        std::array<std::uint16_t, Blocks * {LEAVES_PER_BLOCK}> stage2;
+        std::array<std::uint64_t, Leaves> leaves;
+
+        /// O(1): three dependent loads and no branches on the data.
+        [[nodiscard]] constexpr bool contains(const char32_t cp) const noexcept {{
+            if(cp > U'\\U{MAX_CODEPOINT:08X}') {{ return false; }}
+            const std::size_t block = stage1[cp >> {BLOCK_SHIFT}U];
+            const std::size_t leaf = stage2[block * {LEAVES_PER_BLOCK}U + ((cp >> {LEAF_SHIFT}U) & {LEAVES_PER_BLOCK - 1}U)];
+            return ((leaves[leaf] >> (cp & 63U)) & 1U) != 0U;
+        }}
+    }};
+
+{letter_table_cpp}
+
+{id_start_table_cpp}
+
+{id_continue_table_cpp}
+
+{whitespace_table_cpp}
+
     // =========================================================================
     // Classification functions
     // =========================================================================
 
     namespace detail {{
         /// Binary search: true if cp is in any of the sorted non-overlapping ranges.
+        /// The classifiers use the lookup tables; this is the reference they are
+        /// verified against.
         ///
         /// Pre:  ranges is sorted by `first` and non-overlapping
         ///       (guaranteed by the static_assert blocks at each table definition).
@@ -517,7 +664,7 @@ namespace jsv::unicode {{
         if(cp < 0x80U) [[likely]] {{
             return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z');
         }}
-        return detail::in_ranges(cp, letter_ranges);
+        return letter_table.contains(cp);
     }}
 
     /// True if cp may start an identifier: \\p{{Letter}} or '_' (U+005F).
@@ -526,7 +673,7 @@ namespace jsv::unicode {{
         if(cp < 0x80U) [[likely]] {{
             return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z') || cp == U'_';
         }}
-        return detail::in_ranges(cp, id_start_ranges);
+        return id_start_table.contains(cp);
     }}
 
     /// True if cp may continue an identifier:
@@ -537,7 +684,7 @@ namespace jsv::unicode {{
             return (cp >= U'A' && cp <= U'Z') || (cp >= U'a' && cp <= U'z')
                 || (cp >= U'0' && cp <= U'9') || cp == U'_';
         }}
-        return detail::in_ranges(cp, id_continue_ranges);
+        return id_continue_table.contains(cp);
     }}
 
     /// True if cp is a Unicode line terminator: NEL (U+0085), LINE SEPARATOR (U+2028),
@@ -556,7 +703,7 @@ namespace jsv::unicode {{
         if(cp < 0x80U) {{ return false; }}             // Other ASCII not in Zs/Zl/Zp
         // Line terminators (U+0085, U+2028, U+2029) are whitespace even if not in Zs/Zl/Zp ranges
         if(is_unicode_line_terminator(cp)) {{ return true; }}
-        return detail::in_ranges(cp, whitespace_ranges);
+        return whitespace_table.contains(cp);
     }}
 }}  // namespace jsv::unicode
 
@@ -629,10 +776,21 @@ def run_clang_format(file_path: Path) -> None:
 # Main
 # -----------------------------------------------------------------------------
 
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument(
+        "--unicode-data",
+        type=Path,
+        help=f"local UnicodeData.txt (Unicode {UNICODE_VERSION}) to use instead of downloading it",
+    )
+    return parser.parse_args()
+
+
 def main() -> None:
+    args = parse_args()
     start_time = time.perf_counter_ns()
 
-    data = download_unicode_data()
+    data = read_unicode_data(args.unicode_data) if args.unicode_data else download_unicode_data()
     print("Parsing UnicodeData.txt...")
     codepoints = parse_codepoints(data)
     print(f"  Parsed {len(codepoints):,} code points.")
@@ -651,8 +809,12 @@ def main() -> None:
     # SC-005 conformance validation
     validate_round_trip(codepoints, generated_ranges)
 
+    print("Building three-stage lookup tables...")
+    generated_tables = {name: build_stage_tables(ranges) for name, ranges in generated_ranges.items()}
+    validate_stage_tables(generated_ranges, generated_tables)
+
     generation_date = date.today().isoformat()
-    header_content = generate_header(generated_ranges, UNICODE_VERSION, generation_date)
+    header_content = generate_header(generated_ranges, generated_tables, UNICODE_VERSION, generation_date)
 
     OUTPUT_PATH.parent.mkdir(parents=True, exist_ok=True)
     OUTPUT_PATH.write_text(header_content, encoding="utf-8")
@@ -6,12 +6,15 @@
 #include "Costanti.hpp"
 // clang-format off
 #ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
 #include <windows.h>
 #endif
 // clang-format on
 DISABLE_WARNINGS_PUSH(
     4005 4201 4459 4514 4625 4626 4820 6244 6285 6385 6386 26408 26409 26415 26418 26426 26429 26432 26437 26438 26440 26446 26447 26450 26451 26455 26457 26459 26460 26461 26462 26467 26472 26473 26474 26475 26481 26482 26485 26490 26491 26493 26494 26495 26496 26497 26498 26800 26814 26818 26821 26826 26827)
 #include <CLI/CLI.hpp>
+#include <cstdio>
 #include <iostream>
 #include <string>
 
@@ -70,6 +73,87 @@ template <> struct fmt::formatter<FormattedSize> : fmt::formatter<std::string> {
     }
 };
 // NOLINTEND(*-diagnostic-double-promotion, *-pro-bounds-constant-array-index, *-identifier-length)
+
+// Small chunks keep the time to the first token low; tokens within
+// `max_token_bytes` of a chunk end are re-scanned for the interner.
+static inline constexpr std::size_t PIPELINE_CHUNK_BYTES = std::size_t{1} << 20U;
+static inline constexpr jsv::StreamLexOptions PIPELINE_LEX_OPTIONS{.window_bytes = PIPELINE_CHUNK_BYTES, .max_token_bytes = std::size_t{64} << 10U};
+
+using DumpFile = std::unique_ptr<std::FILE, int (*)(std::FILE *)>;
+
+// Where the token dump goes: the file at `path`, or stdout (main then logs to stderr).
+static DumpFile open_dump(const std::optional<std::string> &path, [[maybe_unused]] const jsv::TokenFormat format) {
+    if(!path) {
+#ifdef _WIN32
+        if(format == jsv::TokenFormat::Binary) { _setmode(_fileno(stdout), _O_BINARY); }
+#endif
+        return {stdout, [](std::FILE *) { return 0; }};
+    }
+    std::FILE *file = std::fopen(path->c_str(), "wb");  // NOLINT(*-owning-memory)
+    if(file == nullptr) { throw std::system_error(errno, std::generic_category(), FORMAT("Unable to open {}", *path)); }
+    return {file, &std::fclose};
+}
+
+// Lex `path` while a background thread is still reading it: each chunk is
+// lexed as soon as it is complete, hiding the I/O latency behind the lexer.
+// Tokens go to `dump` unless it is null. Returns the number of invalid
+// tokens, each reported at its byte offset.
+static std::size_t lex_pipelined(const std::string &path, jsv::TokenWriter *dump) {
+    const vnd::Timer timer(FORMAT("Pipelined processing of file {}", path));
+    const vnd::Timer firstTokenTimer("Time to first token");
+    const auto ahead = vnd::ReadAhead::from_file(path, PIPELINE_CHUNK_BYTES);
+    jsv::StreamingLexer lexer{[&ahead](char *buffer, const std::size_t size) { return ahead->read(buffer, size); }, path, PIPELINE_LEX_OPTIONS};
+    jsv::Interner interner;
+    lexer.set_interner(&interner);
+    if(dump != nullptr) { dump->set_file(path); }
+    std::size_t count = 0;
+    std::size_t errors = 0;
+    while(true) {
+        const auto token = lexer.next();
+        if(count++ == 0) { LINFO("{}", firstTokenTimer); }
+        if(dump != nullptr) { dump->write(token); }
+        if(token.kind == jsv::TokenKind::Error) [[unlikely]] {
+            ++errors;
+            LERROR("{}", jsv::unexpected_token_diagnostic(path, FORMAT("offset {}", token.offset), token.text));
+        }
+        if(token.kind == jsv::TokenKind::Eof) { break; }
+    }
+    if(dump != nullptr) { dump->flush(); }
+    LINFO("{}", timer);
+    LINFO("{} total of bytes read: {}", path, format_size(ahead->consumed()));
+    LINFO("num tokens {}", count);
+    const auto &symbols = interner.stats();
+    LINFO("identifiers {}, unique symbols {}, bytes saved by interning {}", symbols.lookups, symbols.symbols, format_size(symbols.bytes_saved()));
+    return errors;
+}
+
+// Read and lex every file named by `inputs` on `jobs` workers. Diagnostics,
+// and the tokens unless `dump` is null, come out in input order, then one
+// summary for the whole run.
+static int compile_many(const std::vector<std::string> &inputs, const std::size_t jobs, jsv::TokenWriter *dump) {
+    const auto collected = jsv::collect_inputs(inputs);
+    for(const auto &error : collected.errors) { LERROR("{}", error); }
+    jsv::Driver driver{jobs, dump != nullptr};
+    LINFO("Processing {} files on {} jobs", collected.files.size(), driver.jobs());
+    const auto summary = driver.run(collected.files, [dump](const jsv::FileReport &report) {
+        for(const auto &diagnostic : report.diagnostics) { LERROR("{}", diagnostic); }
+        if(dump != nullptr && report.source) {
+            dump->set_file(report.path);
+            dump->write(report.stream, report.source->text());
+        }
+    });
+    if(dump != nullptr) { dump->flush(); }
+    LINFO("{} files ({} failed), {}, {} tokens, {} diagnostics in {}", summary.files, summary.failed, format_size(summary.bytes),
+          summary.tokens, summary.diagnostics, vnd::Timer::make_time_str(C_LD(summary.wall.count())));
+    std::string phases;
+    for(std::size_t phase = 0; phase < summary.cpu.size(); ++phase) {
+        phases += FORMAT(" {} {}", jsv::phaseToString(static_cast<jsv::Phase>(phase)),
+                         vnd::Timer::make_time_str(C_LD(summary.cpu[phase].count())));
+    }
+    LINFO("cpu time:{}", phases);
+    return collected.errors.empty() && summary.failed == 0 && summary.diagnostics == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 DISABLE_WARNINGS_PUSH(26461 26821)
 // static inline constexpr auto sequence = std::views::iota(0, 9999);
 // NOLINTNEXTLINE(*-function-cognitive-complexity, *-exception-escape)
@@ -92,16 +176,26 @@ auto main(int argc, const char *const argv[]) -> int {
     try {
         CLI::App app{FORMAT("{} version {}", jsav::cmake::project_name, jsav::cmake::project_version)};  // NOLINT(*-include-cleaner)
         // std::optional<std::string> message;  // NOLINT(*-include-cleaner)
-        std::optional<std::string> path;
+        std::vector<std::string> inputs;
         // app.add_option("-m,--message", message, "A message to print back out");
-        app.add_option("-i,--input", path, "The input file");
+        app.add_option("-i,--input,inputs", inputs, "Input files, directories or glob patterns");
+        std::size_t jobs = 0;
+        app.add_option("-j,--jobs", jobs, "Worker threads for multiple inputs (0: one per core)");
+        std::string emit_tokens = "text";
+        app.add_option("--emit-tokens", emit_tokens, "Token dump format: text, jsonl or binary");
+        std::optional<std::string> output;
+        app.add_option("-o,--output", output, "Write the token dump to this file instead of stdout");
         bool show_version = false;
         bool compile = false;
+        bool pipeline = false;
         // bool run = false;
         // bool clean = false;
         // bool create_cmake = false;
         app.add_flag("--version, -v", show_version, "Show version information");
         app.add_flag("--compile, -c", compile, "Compile the resulting code");
+        app.add_flag("--pipeline, -p", pipeline, "Lex the input while it is still being read (one input file only)");
+        bool quiet = false;
+        app.add_flag("--quiet, -q", quiet, "Do not dump the tokens, so timings measure only the lexer");
         // app.add_flag("--run, -r", run, "Compile the resulting code and execute it");
         // app.add_flag("--clean, -x", clean, "Clean before building");
         // app.add_flag("--cmake, -m", create_cmake, "Create a CMakeLists.txt file");
@@ -110,7 +204,27 @@ auto main(int argc, const char *const argv[]) -> int {
             LINFO("{}", jsav::cmake::project_version);
             return EXIT_SUCCESS;
         }
-        const auto porfilename = fs::canonical(fs::path(path.value_or(filename.data())).lexically_normal()).string();
+        const auto token_format = jsv::parseTokenFormat(emit_tokens);
+        if(!token_format) {
+            LERROR("Unknown token format: {} (expected text, jsonl or binary)", emit_tokens);
+            return EXIT_FAILURE;
+        }
+        // Without -o the token dump owns stdout, so the log moves to stderr.
+        if(!quiet && !output) { log_to_stderr(); }
+        if(inputs.empty()) { inputs.emplace_back(filename); }
+        // One plain file keeps the detailed single-file output below.
+        if(inputs.size() > 1 || fs::is_directory(inputs.front()) || jsv::is_glob_input(inputs.front())) {
+            if(pipeline) {
+                LERROR("--pipeline takes a single input file");
+                return EXIT_FAILURE;
+            }
+            const vnd::AutoTimer compilationTime("Total Execution");
+            if(quiet) { return compile_many(inputs, jobs, nullptr); }
+            const auto out = open_dump(output, *token_format);
+            jsv::TokenWriter dump{out.get(), *token_format};
+            return compile_many(inputs, jobs, &dump);
+        }
+        const auto porfilename = fs::canonical(fs::path(inputs.front()).lexically_normal()).string();
         /*if(clean) {
             const auto folderPath = vnd::GetBuildFolder(fs::path(porfilename));
             LINFO("Cleaning the project");
@@ -133,22 +247,54 @@ auto main(int argc, const char *const argv[]) -> int {
         */
 
         const vnd::AutoTimer compilationTime("Total Execution");
+        if(pipeline) {
+            std::size_t errors = 0;
+            if(quiet) {
+                errors = lex_pipelined(porfilename, nullptr);
+            } else {
+                const auto out = open_dump(output, *token_format);
+                jsv::TokenWriter dump{out.get(), *token_format};
+                errors = lex_pipelined(porfilename, &dump);
+            }
+            return errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
         const vnd::Timer timer(FORMAT("Processing file {}", porfilename));
-        const auto str = vnd::readFromFile(porfilename);
+        // Regular files are mapped, not copied: the lexer reads the page cache directly.
+        jsv::SourceManager sources;
+        const auto file_id = sources.load(porfilename);
+        const auto &source = sources.buffer(file_id);
         const auto processing_time = timer.to_string();
         LINFO(processing_time);
 
-        [[maybe_unused]] const std::string_view code(str);
-        const auto size_bytes = str.size();
+        const auto size_bytes = source.size();
         const auto fsz = format_size(size_bytes);
-        LINFO("{} total of bytes read: {}", porfilename, fsz);
-        jsv::Lexer lexer{code, porfilename};
+        LINFO("{} total of bytes read: {}{}", porfilename, fsz, source.is_mapped() ? " (mapped)" : "");
+        jsv::Interner interner;
+        jsv::Lexer lexer{sources, file_id};
+        lexer.set_interner(&interner);
         const vnd::Timer tokenizationTimer("Tokenization");
-        const auto tokens = lexer.tokenize();
+        jsv::TokenStream tokens;
+        lexer.tokenize_into(tokens);
         LINFO("{}", tokenizationTimer);
         LINFO("num tokens {}", tokens.size());
+        const auto &symbols = interner.stats();
+        LINFO("identifiers {}, unique symbols {}, bytes saved by interning {}", symbols.lookups, symbols.symbols,
+              format_size(symbols.bytes_saved()));
+        std::vector<std::string> diagnostics;
+        jsv::append_error_diagnostics(tokens, source.text(), porfilename, diagnostics);
+        for(const auto &diagnostic : diagnostics) { LERROR("{}", diagnostic); }
 
-        for(jsv::Token token : tokens) { LINFO("{}", token); }
+        if(!quiet) {
+            const vnd::Timer dumpTimer("Token dump");
+            const auto out = open_dump(output, *token_format);
+            jsv::TokenWriter dump{out.get(), *token_format};
+            dump.set_file(porfilename);
+            dump.write(tokens, source.text());
+            dump.flush();
+            LINFO("{}", dumpTimer);
+            LINFO("token dump size: {}", format_size(dump.bytes_written()));
+        }
+        if(!diagnostics.empty()) { return EXIT_FAILURE; }
         // LINFO("{}", code);
         /*vnd::Tokenizer tokenizer{code, porfilename};
         std::vector<vnd::TokenVec> tokens;
@@ -172,9 +318,11 @@ auto main(int argc, const char *const argv[]) -> int {
     } catch(const std::exception &e) {
         // Handle any other types of exceptions
         LERROR("Unhandled exception in main: {}", e.what());
+        return EXIT_FAILURE;
     } catch(...) {
         // Handle any other types of exceptions
         LERROR("An unknown error occurred while creating the folder.");
+        return EXIT_FAILURE;
     }
     return EXIT_SUCCESS;  // Return appropriate exit code
 }
@@ -0,0 +1,99 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsavCore/ReadAhead.hpp"
+
+namespace vnd {
+
+    ReadAhead::ReadAhead(Source source, const std::size_t chunk_bytes, const std::size_t chunks)
+      : m_source{vnd_move(source)}, m_chunk_bytes{std::max<std::size_t>(chunk_bytes, 1)}, m_ring(std::max<std::size_t>(chunks, 1)) {
+        for(auto &chunk : m_ring) { chunk.data = std::make_unique_for_overwrite<char[]>(m_chunk_bytes); }
+        m_reader = std::jthread{[this](const std::stop_token &stop) { produce(stop); }};
+    }
+
+    std::unique_ptr<ReadAhead> ReadAhead::from_file(const std::string_view filename, const std::size_t chunk_bytes, const std::size_t chunks) {
+        const fs::path filePath(filename);
+        std::error_code error;
+        const auto status = fs::status(filePath, error);
+        if(!fs::exists(status)) { throw FILEREADEREERRORF("File not found: {}", filePath.string()); }
+        if(fs::is_directory(status)) { throw FILEREADEREERRORF("Path is not a regular file: {}", filePath.string()); }
+        auto stream = std::make_shared<std::ifstream>(filePath, std::ios::in | std::ios::binary);
+        if(!stream->is_open()) { throw FILEREADEREERRORF("Unable to open file: {}", filePath.string()); }
+        return std::make_unique<ReadAhead>(
+            [stream, name = filePath.string()](char *buffer, const std::size_t size) {
+                stream->read(buffer, static_cast<std::streamsize>(size));
+                if(stream->bad()) { throw FILEREADEREERRORF("Unable to read file: {}. Reason: stream error", name); }
+                return C_ST(stream->gcount());
+            },
+            chunk_bytes, chunks);
+    }
+
+    void ReadAhead::produce(const std::stop_token &stop) {
+        std::size_t tail = 0;
+        try {
+            while(true) {
+                {
+                    std::unique_lock lock{m_mutex};
+                    if(!m_free.wait(lock, stop, [this] { return m_filled < m_ring.size(); })) { return; }
+                }
+                // The consumer only touches completed chunks, so this one is
+                // filled without holding the lock.
+                auto &chunk = m_ring[tail];
+                std::size_t size = 0;
+                while(size < m_chunk_bytes && !stop.stop_requested()) {
+                    const auto got = m_source(chunk.data.get() + size, m_chunk_bytes - size);
+                    if(got == 0) { break; }
+                    size += got;
+                }
+                const bool last = size < m_chunk_bytes;
+                {
+                    const std::scoped_lock lock{m_mutex};
+                    chunk.size = size;
+                    if(size != 0) { ++m_filled; }
+                    m_done = last;
+                }
+                m_ready.notify_one();
+                if(last) { return; }
+                tail = (tail + 1) % m_ring.size();
+            }
+        } catch(...) {
+            {
+                const std::scoped_lock lock{m_mutex};
+                m_error = std::current_exception();
+                m_done = true;
+            }
+            m_ready.notify_one();
+        }
+    }
+
+    std::size_t ReadAhead::read(char *buffer, const std::size_t size) {
+        {
+            std::unique_lock lock{m_mutex};
+            m_ready.wait(lock, [this] { return m_filled != 0 || m_done; });
+            if(m_filled == 0) {
+                if(m_error) { std::rethrow_exception(m_error); }
+                return 0;
+            }
+        }
+        // PERF: the copy runs unlocked; the reader never touches a completed chunk.
+        const auto &chunk = m_ring[m_head];
+        const auto count = std::min(size, chunk.size - m_offset);
+        std::memcpy(buffer, chunk.data.get() + m_offset, count);
+        m_offset += count;
+        m_consumed += count;
+        if(m_offset == chunk.size) {
+            m_offset = 0;
+            m_head = (m_head + 1) % m_ring.size();
+            {
+                const std::scoped_lock lock{m_mutex};
+                --m_filled;
+            }
+            m_free.notify_one();
+        }
+        return count;
+    }
+
+}  // namespace vnd
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,215 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsavCore/SourceBuffer.hpp"
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vnd {
+
+    namespace {
+        /// Backing of every empty buffer: no text, `padding` zero bytes.
+        alignas(64) constexpr std::array<char, SourceBuffer::padding> empty_text{};
+
+        /// Regular files smaller than this are read: a mapping costs more than the copy.
+        constexpr std::size_t map_threshold = std::size_t{64} * 1024;
+
+        [[nodiscard]] std::string errno_message() { return std::generic_category().message(errno); }
+
+#ifndef _WIN32
+        /// Closes a file descriptor on scope exit.
+        class FdGuard {
+        public:
+            explicit FdGuard(const int fd) noexcept : m_fd{fd} {}
+            FdGuard(const FdGuard &) = delete;
+            FdGuard &operator=(const FdGuard &) = delete;
+            FdGuard(FdGuard &&) = delete;
+            FdGuard &operator=(FdGuard &&) = delete;
+            ~FdGuard() { ::close(m_fd); }
+
+        private:
+            int m_fd;
+        };
+#endif
+    }  // namespace
+
+    SourceBuffer::SourceBuffer() noexcept : m_data{empty_text.data()} {}
+
+    SourceBuffer::SourceBuffer(SourceBuffer &&other) noexcept
+      : m_data{std::exchange(other.m_data, empty_text.data())}, m_size{std::exchange(other.m_size, 0)},
+        m_mapped_size{std::exchange(other.m_mapped_size, 0)}, m_heap{vnd_move(other).m_heap} {}
+
+    SourceBuffer &SourceBuffer::operator=(SourceBuffer &&other) noexcept {
+        if(this != &other) {
+            release();
+            m_data = std::exchange(other.m_data, empty_text.data());
+            m_size = std::exchange(other.m_size, 0);
+            m_mapped_size = std::exchange(other.m_mapped_size, 0);
+            m_heap = vnd_move(other).m_heap;
+        }
+        return *this;
+    }
+
+    SourceBuffer::~SourceBuffer() { release(); }
+
+    void SourceBuffer::release() noexcept {
+#ifndef _WIN32
+        // NOLINTNEXTLINE(*-const-cast)
+        if(m_mapped_size != 0) { ::munmap(const_cast<char *>(m_data), m_mapped_size); }
+#endif
+        m_heap.reset();
+        m_data = empty_text.data();
+        m_size = 0;
+        m_mapped_size = 0;
+    }
+
+    SourceBuffer SourceBuffer::allocate(const std::size_t size) {
+        SourceBuffer buffer;
+        // PERF: only the padding is zeroed; the caller overwrites the text bytes.
+        buffer.m_heap = std::make_unique_for_overwrite<char[]>(size + padding);
+        std::memset(buffer.m_heap.get() + size, 0, padding);
+        buffer.m_data = buffer.m_heap.get();
+        buffer.m_size = size;
+        return buffer;
+    }
+
+    SourceBuffer SourceBuffer::copy_of(const std::string_view text) {
+        if(text.empty()) { return {}; }
+        auto buffer = allocate(text.size());
+        std::memcpy(buffer.m_heap.get(), text.data(), text.size());
+        return buffer;
+    }
+
+    SourceBuffer SourceBuffer::from_file(const std::string_view filename) {
+        auto result = try_from_file(filename);
+        if(!result) { throw vnd_move(result).error(); }
+        return vnd_move(result).value();
+    }
+
+#ifdef _WIN32
+    SourceBufferResult SourceBuffer::try_from_file(const std::string_view filename) {
+        const fs::path filePath(filename);
+        std::error_code error;
+        const auto status = fs::status(filePath, error);
+        if(!fs::exists(status)) { return std::unexpected(FILEREADEREERRORF("File not found: {}", filePath.string())); }
+        if(fs::is_directory(status)) { return std::unexpected(FILEREADEREERRORF("Path is not a regular file: {}", filePath.string())); }
+        std::ifstream fileStream(filePath, std::ios::in | std::ios::binary);
+        if(!fileStream.is_open()) { return std::unexpected(FILEREADEREERRORF("Unable to open file: {}", filePath.string())); }
+        const std::string content{std::istreambuf_iterator<char>(fileStream), std::istreambuf_iterator<char>()};
+        if(fileStream.bad()) { return std::unexpected(FILEREADEREERRORF("Unable to read file: {}. Reason: stream error", filePath.string())); }
+        return copy_of(content);
+    }
+#else
+    SourceBufferResult SourceBuffer::try_from_file(const std::string_view filename) {
+        const fs::path filePath(filename);
+        std::error_code error;
+        const auto status = fs::status(filePath, error);
+        if(!fs::exists(status)) { return std::unexpected(FILEREADEREERRORF("File not found: {}", filePath.string())); }
+        if(fs::is_directory(status)) { return std::unexpected(FILEREADEREERRORF("Path is not a regular file: {}", filePath.string())); }
+
+        // NOLINTNEXTLINE(*-vararg)
+        const int fd = ::open(filePath.c_str(), O_RDONLY | O_CLOEXEC);
+        if(fd < 0) { return std::unexpected(FILEREADEREERRORF("Unable to open file: {}. Reason: {}", filePath.string(), errno_message())); }
+        const FdGuard guard{fd};
+        struct stat info {};
+        if(::fstat(fd, &info) != 0) {
+            return std::unexpected(FILEREADEREERRORF("Unable to read file: {}. Reason: {}", filePath.string(), errno_message()));
+        }
+
+        const bool regular = S_ISREG(info.st_mode);
+        const auto fileSize = regular ? C_ST(info.st_size) : std::size_t{0};
+        if(regular && fileSize >= map_threshold) {
+            // Reserve the whole padded range as zero pages, then map the file
+            // over its start: the tail of the last file page past EOF reads as
+            // zero, and so do the reserved pages after it.
+            const auto page = C_ST(::sysconf(_SC_PAGESIZE));
+            const auto mappedSize = (fileSize + padding + page - 1) / page * page;
+            void *reserved = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if(reserved != MAP_FAILED) {
+                if(::mmap(reserved, fileSize, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) != MAP_FAILED) {
+                    ::madvise(reserved, mappedSize, MADV_SEQUENTIAL);
+                    SourceBuffer buffer;
+                    buffer.m_data = static_cast<const char *>(reserved);
+                    buffer.m_size = fileSize;
+                    buffer.m_mapped_size = mappedSize;
+                    return buffer;
+                }
+                ::munmap(reserved, mappedSize);
+            }
+            // Mapping refused (e.g. a filesystem without mmap): fall through to read().
+        }
+
+        // Regular files are read with pread() into a buffer of their stat size
+        // (fewer bytes if truncated meanwhile), so no file offset is shared;
+        // pipes, devices and size-less files such as those in /proc are read
+        // until EOF, growing the buffer as needed.
+        const bool sized = fileSize != 0;
+        auto capacity = sized ? fileSize : std::size_t{64} * 1024;
+        auto buffer = allocate(capacity);
+        std::size_t length = 0;
+        while(true) {
+            if(length == capacity) {
+                if(sized) { break; }
+                auto grown = allocate(capacity * 2);
+                std::memcpy(grown.m_heap.get(), buffer.m_heap.get(), length);
+                buffer = vnd_move(grown);
+                capacity *= 2;
+            }
+            char *const target = buffer.m_heap.get() + length;
+            const auto got = regular ? ::pread(fd, target, capacity - length, static_cast<off_t>(length)) : ::read(fd, target, capacity - length);
+            if(got < 0) {
+                if(errno == EINTR) { continue; }
+                return std::unexpected(FILEREADEREERRORF("Unable to read file: {}. Reason: {}", filePath.string(), errno_message()));
+            }
+            if(got == 0) { break; }
+            length += C_ST(got);
+        }
+        if(length == 0) { return SourceBuffer{}; }
+        std::memset(buffer.m_heap.get() + length, 0, padding);
+        buffer.m_size = length;
+        return buffer;
+    }
+#endif
+
+    std::vector<SourceBufferResult> SourceBuffer::from_files(const std::span<const std::string> filenames, const std::size_t threads) {
+        std::vector<std::optional<SourceBufferResult>> slots(filenames.size());
+        // Each worker claims the next unread path; results land in their own slot.
+        std::atomic<std::size_t> next{0};
+        const auto work = [&] {
+            for(auto i = next.fetch_add(1, std::memory_order_relaxed); i < filenames.size(); i = next.fetch_add(1, std::memory_order_relaxed)) {
+                try {
+                    slots[i].emplace(try_from_file(filenames[i]));
+                } catch(const std::exception &e) {
+                    // e.g. std::bad_alloc: must not escape a worker thread.
+                    slots[i].emplace(std::unexpect, FILEREADEREERRORF("Unable to read file: {}. Reason: {}", filenames[i], e.what()));
+                }
+            }
+        };
+
+        const auto wanted = threads != 0 ? threads : std::max(1U, std::thread::hardware_concurrency());
+        const auto workerCount = std::min(wanted, filenames.size());
+        if(workerCount <= 1) {
+            work();
+        } else {
+            std::vector<std::jthread> workers;
+            workers.reserve(workerCount - 1);
+            for(std::size_t i = 1; i < workerCount; ++i) { workers.emplace_back(work); }
+            work();
+        }
+
+        std::vector<SourceBufferResult> results;
+        results.reserve(slots.size());
+        for(auto &slot : slots) { results.push_back(vnd_move_always(*slot)); }
+        return results;
+    }
+
+}  // namespace vnd
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,172 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/driver/Driver.hpp"
+
+#include <ctime>
+
+namespace jsv {
+
+    namespace {
+        /// Longest piece of an invalid token quoted in a diagnostic.
+        constexpr std::size_t max_quoted_bytes = 32;
+
+        /// CPU time used so far by the calling thread. Where there is no
+        /// per-thread clock, wall time stands in for it.
+        [[nodiscard]] std::chrono::nanoseconds thread_cpu_time() noexcept {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+            timespec now{};
+            ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+            return std::chrono::seconds{now.tv_sec} + std::chrono::nanoseconds{now.tv_nsec};
+#else
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+#endif
+        }
+
+        /// Adds the CPU time the calling thread spends in its scope to `total`.
+        class PhaseClock {
+        public:
+            explicit PhaseClock(std::atomic<std::int64_t> &total) noexcept : m_total{total}, m_start{thread_cpu_time()} {}
+            PhaseClock(const PhaseClock &) = delete;
+            PhaseClock &operator=(const PhaseClock &) = delete;
+            PhaseClock(PhaseClock &&) = delete;
+            PhaseClock &operator=(PhaseClock &&) = delete;
+            ~PhaseClock() { m_total.fetch_add((thread_cpu_time() - m_start).count(), std::memory_order_relaxed); }
+
+        private:
+            std::atomic<std::int64_t> &m_total;
+            std::chrono::nanoseconds m_start;
+        };
+
+        void lex_file(const vnd::SourceBuffer &buffer, FileReport &report, const bool keep_tokens) {
+            // Unless kept, reused by every file lexed on this thread, so its
+            // arrays are allocated once per worker rather than once per file.
+            thread_local TokenStream scratch;  // NOLINT(*-avoid-non-const-global-variables)
+            auto &tokens = keep_tokens ? report.stream : scratch;
+            Lexer lexer{buffer, report.path};
+            try {
+                lexer.tokenize_into(tokens);
+            } catch(const std::length_error &error) {
+                report.failed = true;
+                report.diagnostics.emplace_back(FORMAT("{}: error: {}", report.path, error.what()));
+                return;
+            }
+            report.tokens = tokens.size();
+            append_error_diagnostics(tokens, buffer.text(), report.path, report.diagnostics);
+        }
+    }  // namespace
+
+    void append_error_diagnostics(const TokenStream &tokens, const std::string_view text, const std::string_view path,
+                                  std::vector<std::string> &out) {
+        const auto kinds = tokens.kinds();
+        std::optional<LineIndex> lines;  // Only built for a file with errors.
+        std::size_t hint = 0;
+        for(std::size_t i = 0; i < kinds.size(); ++i) {
+            if(kinds[i] != TokenKind::Error) [[likely]] { continue; }
+            if(!lines) { lines.emplace(text); }
+            const auto offset = tokens.offsets()[i];
+            const auto location = lines->resolve(offset, hint);
+            out.emplace_back(unexpected_token_diagnostic(path, FORMAT("{}:{}", location.line, location.column),
+                                                         text.substr(offset, tokens.lengths()[i])));
+        }
+    }
+
+    std::string unexpected_token_diagnostic(const std::string_view path, const std::string_view position, const std::string_view text) {
+        return FORMAT("{}:{}: error: unexpected '{}'", path, position, text.substr(0, std::min(text.find('\n'), max_quoted_bytes)));
+    }
+
+    DriverSummary Driver::run(const std::span<const std::string> paths, const ReportCallback &on_report) {
+        const auto start = std::chrono::steady_clock::now();
+        std::array<std::atomic<std::int64_t>, static_cast<std::size_t>(Phase::Count)> cpu{};
+        const auto clock = [&cpu](const Phase phase) -> auto & { return cpu[static_cast<std::size_t>(phase)]; };
+
+        // Reports finish in any order; each waits in its slot until every
+        // report before it has been delivered. Only files in [next, next +
+        // window()) are in flight, so the slots form a ring and a slow file
+        // holds back at most `window()` finished reports.
+        const auto in_flight = window();
+        std::vector<std::optional<FileReport>> slots(std::min(in_flight, paths.size()));
+        std::size_t next = 0;
+        std::size_t started = 0;
+        DriverSummary summary;
+        std::mutex deliver_mutex;
+        // First exception thrown by `on_report`: nothing more is started or
+        // delivered, and `run` rethrows it once the files in flight finish.
+        std::exception_ptr report_error;
+        std::function<void()> start_files;  // Needs `deliver`; assigned below.
+        const auto deliver = [&](const std::size_t index, FileReport report) {
+            const std::scoped_lock lock{deliver_mutex};
+            slots[index % slots.size()] = vnd_move(report);
+            for(; !report_error && next < paths.size() && slots[next % slots.size()]; ++next) {
+                auto &slot = slots[next % slots.size()];
+                const auto &ready = *slot;
+                ++summary.files;
+                summary.failed += ready.failed ? 1 : 0;
+                summary.bytes += ready.bytes;
+                summary.tokens += ready.tokens;
+                summary.diagnostics += ready.diagnostics.size();
+                if(on_report) {
+                    try {
+                        on_report(ready);
+                    } catch(...) { report_error = std::current_exception(); }
+                }
+                slot.reset();
+            }
+            if(!report_error) { start_files(); }
+        };
+
+        const auto process = [&](const std::size_t i) {
+            FileReport report;
+            report.path = paths[i];
+            std::shared_ptr<const vnd::SourceBuffer> buffer;
+            {
+                const PhaseClock timed{clock(Phase::Read)};
+                auto result = vnd::SourceBuffer::try_from_file(report.path);
+                if(result) {
+                    buffer = std::make_shared<const vnd::SourceBuffer>(vnd_move_always(*result));
+                } else {
+                    report.failed = true;
+                    report.diagnostics.emplace_back(FORMAT("error: {}", result.error().what()));
+                }
+            }
+            if(!buffer) {
+                deliver(i, vnd_move(report));
+                return;
+            }
+            report.bytes = buffer->size();
+            // Submitted from this worker, so it runs here next unless stolen.
+            m_pool.submit([&, i, buffer, report = vnd_move(report)]() mutable {
+                {
+                    const PhaseClock timed{clock(Phase::Lex)};
+                    lex_file(*buffer, report, m_keep_tokens);
+                }
+                if(m_keep_tokens) { report.source = buffer; }
+                deliver(i, vnd_move(report));
+            });
+        };
+
+        // Called under `deliver_mutex`. Files join the pool's FIFO, so idle
+        // workers take the oldest one, the next to be delivered.
+        start_files = [&] {
+            for(; started < paths.size() && started < next + in_flight; ++started) {
+                m_pool.submit_fifo([&process, i = started] { process(i); });
+            }
+        };
+        {
+            const std::scoped_lock lock{deliver_mutex};
+            start_files();
+        }
+        m_pool.wait();
+        if(report_error) { std::rethrow_exception(report_error); }
+
+        summary.wall = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        for(std::size_t phase = 0; phase < cpu.size(); ++phase) {
+            summary.cpu[phase] = std::chrono::nanoseconds{cpu[phase].load(std::memory_order_relaxed)};
+        }
+        return summary;
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,104 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/driver/Inputs.hpp"
+#include <unordered_set>
+
+namespace jsv {
+
+    namespace {
+        [[nodiscard]] bool is_pattern(const std::string_view component) noexcept { return std::ranges::any_of(component, is_glob_char); }
+
+        [[nodiscard]] bool names_file(const fs::path &path) noexcept {
+            std::error_code error;
+            return fs::is_regular_file(path, error);
+        }
+
+        /// Entries of `dir` (the working directory when empty), sorted by name.
+        [[nodiscard]] std::vector<fs::path> sorted_entries(const fs::path &dir) {
+            std::vector<fs::path> entries;
+            std::error_code error;
+            for(fs::directory_iterator it{dir.empty() ? fs::path{"."} : dir, fs::directory_options::skip_permission_denied, error}, end;
+                !error && it != end; it.increment(error)) {
+                entries.push_back(dir.empty() ? it->path().filename() : it->path());
+            }
+            std::ranges::sort(entries);
+            return entries;
+        }
+
+        /// Append to `out` the files under `dir` matching `parts[index..]`.
+        // NOLINTNEXTLINE(*-no-recursion)
+        void expand(const fs::path &dir, const std::vector<std::string> &parts, const std::size_t index, std::vector<fs::path> &out) {
+            if(index == parts.size()) {
+                if(names_file(dir)) { out.push_back(dir); }
+                return;
+            }
+            const auto &part = parts[index];
+            if(part == "**") {
+                expand(dir, parts, index + 1, out);
+                for(const auto &entry : sorted_entries(dir)) {
+                    std::error_code error;
+                    if(fs::is_directory(entry, error) && !fs::is_symlink(entry, error)) { expand(entry, parts, index, out); }
+                }
+            } else if(is_pattern(part)) {
+                for(const auto &entry : sorted_entries(dir)) {
+                    if(glob_match(part, entry.filename().string())) { expand(entry, parts, index + 1, out); }
+                }
+            } else {
+                expand(dir / part, parts, index + 1, out);
+            }
+        }
+
+        /// Every `source_extension` file under `dir`, sorted.
+        [[nodiscard]] std::vector<fs::path> sources_under(const fs::path &dir) {
+            std::vector<fs::path> files;
+            std::error_code error;
+            for(fs::recursive_directory_iterator it{dir, fs::directory_options::skip_permission_denied, error}, end; !error && it != end;
+                it.increment(error)) {
+                if(it->path().extension() == source_extension && it->is_regular_file(error)) { files.push_back(it->path()); }
+            }
+            std::ranges::sort(files);
+            return files;
+        }
+    }  // namespace
+
+    bool is_glob_input(const std::string &input) {
+        std::error_code error;
+        return is_pattern(input) && !fs::exists(input, error);
+    }
+
+    InputFiles collect_inputs(const std::span<const std::string> inputs) {
+        InputFiles result;
+        std::unordered_set<std::string> seen;
+        const auto add = [&](const fs::path &file) {
+            if(seen.insert(file.lexically_normal().generic_string()).second) { result.files.push_back(file.string()); }
+        };
+
+        for(const auto &input : inputs) {
+            const fs::path path{input};
+            std::error_code error;
+            std::vector<fs::path> matches;
+            if(is_glob_input(input)) {
+                std::vector<std::string> parts;
+                for(const auto &part : path) { parts.push_back(part.string()); }
+                // The leading components without glob characters are used as they are.
+                fs::path base;
+                std::size_t first = 0;
+                while(!is_pattern(parts[first])) { base /= parts[first++]; }
+                expand(base, parts, first, matches);
+                if(matches.empty()) { result.errors.push_back(FORMAT("No files match: {}", input)); }
+            } else if(fs::is_directory(path, error)) {
+                matches = sources_under(path);
+                if(matches.empty()) { result.errors.push_back(FORMAT("No {} files in directory: {}", source_extension, input)); }
+            } else {
+                matches.push_back(path);
+            }
+            for(const auto &match : matches) { add(match); }
+        }
+        return result;
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,181 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/driver/TokenWriter.hpp"
+
+#include "jsav/lexer/SourceSpan.hpp"
+#include "jsav/lexer/unicode/Utf8.hpp"
+
+namespace jsv {
+
+    namespace {
+        constexpr std::string_view hex_digits = "0123456789abcdef";
+
+        /// Append `value` as `bytes` little-endian bytes.
+        void append_le(fmt::memory_buffer &out, std::uint64_t value, const std::size_t bytes) {
+            for(std::size_t i = 0; i < bytes; ++i, value >>= 8U) { out.push_back(static_cast<char>(value & 0xFFU)); }
+        }
+
+        void append_number(fmt::memory_buffer &out, const std::uint64_t value) { fmt::format_to(std::back_inserter(out), "{}", value); }
+    }  // namespace
+
+    TokenWriter::~TokenWriter() {
+        try {
+            flush();
+        } catch(...) {  // NOLINT(*-empty-catch)
+            // Reported only by an explicit `flush`.
+        }
+    }
+
+    void TokenWriter::set_file(const std::string_view path) {
+        if(m_format == TokenFormat::Text) {
+            m_path = truncate_path(fs::path{path}, 2);
+        } else if(m_format == TokenFormat::Jsonl) {
+            // Escaped once here rather than for every token.
+            const auto mark = m_buffer.size();
+            append_escaped(path);
+            m_path.assign(m_buffer.data() + mark, m_buffer.size() - mark);
+            m_buffer.resize(mark);
+        } else {
+            start_binary();
+            m_buffer.push_back(static_cast<char>(binary_file_kind));
+            append_le(m_buffer, path.size(), 4);
+            m_buffer.append(path);
+            if(m_buffer.size() >= flush_bytes) { flush(); }
+        }
+    }
+
+    void TokenWriter::start_binary() {
+        if(!m_started) { m_buffer.append(binary_magic); }
+        m_started = true;
+    }
+
+    void TokenWriter::write(const TokenStream &tokens, const std::string_view source) {
+        const auto kinds = tokens.kinds();
+        const auto offsets = tokens.offsets();
+        const auto lengths = tokens.lengths();
+        const auto payloads = tokens.payloads();
+        std::optional<LineIndex> lines;
+        if(m_format != TokenFormat::Binary) { lines.emplace(source); }
+        std::size_t hint = 0;
+        for(std::size_t i = 0; i < kinds.size(); ++i) {
+            SourceLocation location;
+            if(lines) { location = lines->resolve(offsets[i], hint); }
+            emit(kinds[i], source.substr(offsets[i], lengths[i]), offsets[i], lengths[i], payloads[i], lines ? &location : nullptr);
+        }
+    }
+
+    void TokenWriter::write(const StreamToken &token) { emit(token.kind, token.text, token.offset, token.length, token.payload, nullptr); }
+
+    void TokenWriter::emit(const TokenKind kind, const std::string_view text, const std::uint64_t offset, const std::uint32_t length,
+                           const std::uint32_t payload, const SourceLocation *location) {
+        auto &out = m_buffer;
+        switch(m_format) {
+        case TokenFormat::Text:
+            out.append(tokenKindToString(kind));
+            out.append(std::string_view{"(\""});
+            append_escaped(text);
+            out.append(std::string_view{"\") "});
+            out.append(m_path);
+            if(location != nullptr) {
+                out.push_back(':');
+                append_number(out, location->line);
+                out.push_back(':');
+                append_number(out, location->column);
+            } else {
+                out.append(std::string_view{":offset "});
+                append_number(out, offset);
+            }
+            out.push_back('\n');
+            break;
+        case TokenFormat::Jsonl:
+            out.append(std::string_view{R"({"file":")"});
+            out.append(m_path);
+            out.append(std::string_view{R"(","kind":")"});
+            out.append(tokenKindToString(kind));
+            out.append(std::string_view{R"(","text":")"});
+            append_escaped(text);
+            out.append(std::string_view{R"(","offset":)"});
+            append_number(out, offset);
+            out.append(std::string_view{R"(,"length":)"});
+            append_number(out, length);
+            if(location != nullptr) {
+                out.append(std::string_view{R"(,"line":)"});
+                append_number(out, location->line);
+                out.append(std::string_view{R"(,"column":)"});
+                append_number(out, location->column);
+            }
+            out.append(std::string_view{"}\n"});
+            break;
+        case TokenFormat::Binary:
+            start_binary();
+            out.push_back(static_cast<char>(kind));
+            append_le(out, offset, 8);
+            append_le(out, length, 4);
+            append_le(out, payload, 4);
+            break;
+        }
+        if(out.size() >= flush_bytes) { flush(); }
+    }
+
+    void TokenWriter::append_escaped(const std::string_view text) {
+        const bool json = m_format == TokenFormat::Jsonl;
+        auto &out = m_buffer;
+        // PERF: runs of bytes that need no escape are copied in one append.
+        std::size_t run = 0;
+        std::size_t i = 0;
+        while(i < text.size()) {
+            const auto byte = C_UC(text[i]);
+            if(byte >= 0x20U && byte != '"' && byte != '\\' && byte != 0x7FU) [[likely]] {
+                if(byte < 0x80U) {
+                    ++i;
+                    continue;
+                }
+                if(const auto decoded = unicode::decode_utf8(text, i); decoded.status == unicode::Utf8Status::Ok) {
+                    i += decoded.byte_length;
+                    continue;
+                }
+            }
+            out.append(text.substr(run, i - run));
+            switch(byte) {
+            case '"':
+                out.append(std::string_view{"\\\""});
+                break;
+            case '\\':
+                out.append(std::string_view{"\\\\"});
+                break;
+            case '\n':
+                out.append(std::string_view{"\\n"});
+                break;
+            case '\r':
+                out.append(std::string_view{"\\r"});
+                break;
+            case '\t':
+                out.append(std::string_view{"\\t"});
+                break;
+            default:
+                // A control byte, or a byte of invalid UTF-8 (JSON strings
+                // must be valid UTF-8, so it becomes the code point U+00XX).
+                out.append(json ? std::string_view{"\\u00"} : std::string_view{"\\x"});
+                out.push_back(hex_digits[byte >> 4U]);
+                out.push_back(hex_digits[byte & 0xFU]);
+                break;
+            }
+            run = ++i;
+        }
+        out.append(text.substr(run));
+    }
+
+    void TokenWriter::flush() {
+        if(m_buffer.size() == 0) { return; }
+        const auto size = m_buffer.size();
+        const auto written = std::fwrite(m_buffer.data(), 1, size, m_out);
+        m_written += written;
+        m_buffer.clear();
+        if(written != size || std::fflush(m_out) != 0) { throw std::system_error(errno, std::generic_category(), "Unable to write tokens"); }
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,118 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/driver/WorkStealingPool.hpp"
+
+namespace jsv {
+
+    namespace {
+        /// Pool and index of the worker running on this thread, if any.
+        thread_local const WorkStealingPool *t_pool = nullptr;  // NOLINT(*-avoid-non-const-global-variables)
+        thread_local std::size_t t_worker = 0;                   // NOLINT(*-avoid-non-const-global-variables)
+    }  // namespace
+
+    WorkStealingPool::WorkStealingPool(const std::size_t threads) {
+        const auto count = threads != 0 ? threads : std::max(1U, std::thread::hardware_concurrency());
+        m_queues.reserve(count);
+        for(std::size_t i = 0; i < count; ++i) { m_queues.push_back(std::make_unique<Queue>()); }
+        m_workers.reserve(count);
+        for(std::size_t i = 0; i < count; ++i) {
+            m_workers.emplace_back([this, i](const std::stop_token &stop) { work(stop, i); });
+        }
+    }
+
+    // The workers drain their queues once stopped; the jthreads join them.
+    WorkStealingPool::~WorkStealingPool() {
+        for(auto &worker : m_workers) { worker.request_stop(); }
+    }
+
+    void WorkStealingPool::submit(Task task) {
+        if(t_pool == this) {
+            enqueue(*m_queues[t_worker], vnd_move(task));
+        } else {
+            enqueue(m_fifo, vnd_move(task));
+        }
+    }
+
+    void WorkStealingPool::submit_fifo(Task task) { enqueue(m_fifo, vnd_move(task)); }
+
+    void WorkStealingPool::enqueue(Queue &queue, Task task) {
+        {
+            // Queued under `m_mutex`, so a worker never takes a task before it is counted.
+            const std::scoped_lock lock{m_mutex};
+            {
+                // Owners pop their deque from the back, so a nested task runs
+                // next; the FIFO is taken from the front.
+                const std::scoped_lock queue_lock{queue.mutex};
+                queue.tasks.push_back(vnd_move(task));
+            }
+            ++m_pending;
+            ++m_queued;
+        }
+        m_wake.notify_one();
+    }
+
+    void WorkStealingPool::wait() {
+        std::unique_lock lock{m_mutex};
+        m_idle.wait(lock, [this] { return m_pending == 0; });
+        if(m_error) { std::rethrow_exception(std::exchange(m_error, nullptr)); }
+    }
+
+    std::optional<WorkStealingPool::Task> WorkStealingPool::take(const std::size_t self) {
+        std::optional<Task> task;
+        {
+            auto &own = *m_queues[self];
+            const std::scoped_lock lock{own.mutex};
+            if(!own.tasks.empty()) {
+                task.emplace(vnd_move_always(own.tasks.back()));
+                own.tasks.pop_back();
+            }
+        }
+        if(!task) {
+            const std::scoped_lock lock{m_fifo.mutex};
+            if(!m_fifo.tasks.empty()) {
+                task.emplace(vnd_move_always(m_fifo.tasks.front()));
+                m_fifo.tasks.pop_front();
+            }
+        }
+        for(std::size_t i = 1; !task && i < m_queues.size(); ++i) {
+            auto &victim = *m_queues[(self + i) % m_queues.size()];
+            const std::scoped_lock lock{victim.mutex};
+            if(!victim.tasks.empty()) {
+                task.emplace(vnd_move_always(victim.tasks.front()));
+                victim.tasks.pop_front();
+                m_steals.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if(task) {
+            const std::scoped_lock lock{m_mutex};
+            --m_queued;
+        }
+        return task;
+    }
+
+    void WorkStealingPool::work(const std::stop_token &stop, const std::size_t self) {
+        t_pool = this;
+        t_worker = self;
+        while(true) {
+            {
+                std::unique_lock lock{m_mutex};
+                if(!m_wake.wait(lock, stop, [this] { return m_queued != 0; })) { return; }
+            }
+            auto task = take(self);
+            if(!task) { continue; }  // Taken by another worker meanwhile.
+            try {
+                (*task)();
+            } catch(...) {
+                const std::scoped_lock lock{m_mutex};
+                if(!m_error) { m_error = std::current_exception(); }
+            }
+            const std::scoped_lock lock{m_mutex};
+            if(--m_pending == 0) { m_idle.notify_all(); }
+        }
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
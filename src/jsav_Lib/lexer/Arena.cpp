@@ -0,0 +1,34 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/Arena.hpp"
+
+namespace jsv {
+
+    std::string_view Arena::store(const std::string_view text) {
+        char *dest = reserve(text.size());
+        std::ranges::copy(text, dest);
+        return commit(text.size());
+    }
+
+    char *Arena::reserve(const std::size_t size) {
+        if(size > m_block_left) {
+            const auto bytes = std::max(block_size, size);
+            m_blocks.emplace_back(std::make_unique_for_overwrite<char[]>(bytes));  // NOLINT(*-avoid-c-arrays)
+            m_cursor = m_blocks.back().get();
+            m_block_left = bytes;
+        }
+        return m_cursor;
+    }
+
+    std::string_view Arena::commit(const std::size_t used) noexcept {
+        const std::string_view view{m_cursor, used};
+        m_cursor += used;
+        m_block_left -= used;
+        return view;
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
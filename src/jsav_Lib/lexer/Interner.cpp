@@ -0,0 +1,57 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/Interner.hpp"
+
+namespace jsv {
+
+    Interner::Interner() : m_slots(1024) {}
+
+    SymbolId Interner::intern(const std::string_view text) { return intern(text, detail::symbol_hash(text)); }
+
+    SymbolId Interner::intern(const std::string_view text, const std::uint64_t hash) {
+        ++m_stats.lookups;
+        m_stats.bytes_seen += text.size();
+        auto slot = probe(text, hash);
+        if(m_slots[slot].id != no_symbol) { return m_slots[slot].id; }
+
+        if((m_names.size() + 1) * 2 > m_slots.size()) {
+            grow();
+            slot = probe(text, hash);
+        }
+        const auto id = C_UI32T(m_names.size());
+        m_names.push_back(m_arena.store(text));
+        m_slots[slot] = Slot{hash, id};
+        ++m_stats.symbols;
+        m_stats.bytes_stored += text.size();
+        return id;
+    }
+
+    SymbolId Interner::find(const std::string_view text) const noexcept { return m_slots[probe(text, detail::symbol_hash(text))].id; }
+
+    std::size_t Interner::probe(const std::string_view text, const std::uint64_t hash) const noexcept {
+        const auto mask = m_slots.size() - 1;
+        // FNV-1a mixes the high bits best; fold them into the index.
+        auto slot = C_ST(hash ^ (hash >> 32U)) & mask;
+        while(m_slots[slot].id != no_symbol && (m_slots[slot].hash != hash || m_names[m_slots[slot].id] != text)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void Interner::grow() {
+        std::vector<Slot> old(m_slots.size() * 2);
+        std::swap(old, m_slots);
+        const auto mask = m_slots.size() - 1;
+        for(const auto &slot : old) {
+            if(slot.id == no_symbol) { continue; }
+            auto index = C_ST(slot.hash ^ (slot.hash >> 32U)) & mask;
+            while(m_slots[index].id != no_symbol) { index = (index + 1) & mask; }
+            m_slots[index] = slot;
+        }
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
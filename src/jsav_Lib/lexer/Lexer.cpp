@@ -9,17 +9,49 @@
 #include "jsav/lexer/Lexer.hpp"
 #include "jsav/lexer/unicode/UnicodeData.hpp"
 #include "jsav/lexer/unicode/Utf8.hpp"
+#include <charconv>
+#include <thread>
 namespace jsv {
-    Lexer::Lexer(std::string_view source, std::string file_path) : m_source{source}, m_file_path{vnd_move(file_path)} {}
+    namespace {
+        /// Input policy for any `std::string_view`: every read is bounds-checked
+        /// and yields '\0' past the end.
+        struct CheckedInput {
+            [[nodiscard]] static char at(const std::string_view source, const std::size_t index) noexcept {
+                return index < source.size() ? source[index] : '\0';
+            }
+            [[nodiscard]] static bool at_end(const std::string_view source, const std::size_t pos) noexcept { return pos >= source.size(); }
+        };
+
+        /// Input policy for a `vnd::SourceBuffer`. No scanner reads further than
+        /// a few bytes past its position, well inside the zero padding, so reads
+        /// need no check and see the same '\0' as `CheckedInput`; the position is
+        /// compared with the size only when a NUL byte is found.
+        struct SentinelInput {
+            [[nodiscard]] static char at(const std::string_view source, const std::size_t index) noexcept {
+                return *(source.data() + index);  // NOLINT(*-pointer-arithmetic)
+            }
+            [[nodiscard]] static bool at_end(const std::string_view source, const std::size_t pos) noexcept {
+                return at(source, pos) == '\0' && pos >= source.size();
+            }
+        };
+    }  // namespace
+
+    Lexer::Lexer(std::string_view source, std::string file_path, const FileId file_id)
+      : m_source{source}, m_file_path{vnd_move(file_path)}, m_file_id{file_id}, m_line_cursor{source} {
+        skip_bom();
+    }
+
+    Lexer::Lexer(const vnd::SourceBuffer &source, std::string file_path) : Lexer{source.text(), vnd_move(file_path)} { m_sentinel = true; }
+
+    // Managed sources are always `vnd::SourceBuffer`s, so always padded.
+    Lexer::Lexer(const SourceManager &sources, const FileId file_id)
+      : Lexer{sources.text(file_id), std::string{sources.path(file_id)}, file_id} {
+        m_sentinel = true;
+    }
 
     std::vector<Token> Lexer::tokenize() {
         std::vector<Token> tokens;
-        tokens.reserve(m_source.size() / 4);  // rough estimate
-        // Skip UTF-8 BOM (0xEF 0xBB 0xBF) at start of input if present (FR-019)
-        if(m_source.size() >= 3 && C_UC(m_source[0]) == 0xEFU && C_UC(m_source[1]) == 0xBBU && C_UC(m_source[2]) == 0xBFU) {
-            m_pos += 3;
-            m_column += 3;
-        }
+        tokens.reserve(estimated_token_count());
         while(true) {
             auto tok = next_token();
             const bool done = (tok.getKind() == TokenKind::Eof);
@@ -29,182 +61,370 @@ namespace jsv {
         return tokens;
     }
 
-    Token Lexer::next_token() {
-        skip_whitespace_and_comments();
+    std::vector<CompactToken> Lexer::tokenize_compact(const FileId file_id) {
+        check_compact_limit();
+        std::vector<CompactToken> tokens;
+        tokens.reserve(estimated_token_count());
+        while(true) {
+            // No Token is built here, so line/column are never resolved.
+            const auto kind = scan_next();
+            tokens.emplace_back(kind, C_UI32T(m_token_start), C_UI32T(m_pos - m_token_start), file_id, m_payload);
+            if(kind == TokenKind::Eof) { break; }
+        }
+        return tokens;
+    }
+
+    void Lexer::tokenize_into(TokenStream &out, const FileId file_id) {
+        check_compact_limit();
+        out.clear();
+        out.set_file_id(file_id);
+        if(out.capacity() < estimated_token_count()) { out.reserve(estimated_token_count()); }
+        while(true) {
+            const auto kind = scan_next();
+            out.push_back(kind, C_UI32T(m_token_start), C_UI32T(m_pos - m_token_start), m_payload);
+            if(kind == TokenKind::Eof) { break; }
+        }
+    }
+
+    std::vector<std::size_t> Lexer::parallel_chunk_bounds(const std::size_t chunks) const noexcept {
+        std::vector<std::size_t> bounds{m_pos};
+        const auto span = m_source.size() - m_pos;
+        for(std::size_t k = 1; k < chunks; ++k) {
+            const auto boundary = simd::find_byte(m_source, m_pos + span / chunks * k, '\n') + 1;
+            if(boundary < m_source.size() && boundary > bounds.back()) { bounds.push_back(boundary); }
+        }
+        bounds.push_back(m_source.size());
+        return bounds;
+    }
+
+    void Lexer::tokenize_range_into(TokenStream &out, const std::size_t end) {
+        while(true) {
+            const auto kind = scan_next();
+            if(kind != TokenKind::Eof && m_token_start >= end) { break; }
+            out.push_back(kind, C_UI32T(m_token_start), C_UI32T(m_pos - m_token_start), m_payload);
+            if(kind == TokenKind::Eof) { break; }
+        }
+    }
+
+    // NOLINTBEGIN(readability-function-cognitive-complexity)
+    void Lexer::tokenize_parallel_into(TokenStream &out, const ParallelLexOptions &options) {
+        check_compact_limit();
+        const auto threads = options.threads != 0 ? options.threads : std::max(1U, std::thread::hardware_concurrency());
+        const auto wanted = std::min(threads, (m_source.size() - m_pos) / std::max<std::size_t>(options.min_chunk_bytes, 1));
+        const auto bounds = parallel_chunk_bounds(wanted);
+        const auto chunk_count = bounds.size() - 1;
+        if(chunk_count < 2) {
+            tokenize_into(out, options.file_id.value_or(m_file_id));
+            return;
+        }
+
+        // ── Speculative pass: every chunk lexed from its first byte ──────
+        // Validate once here rather than once per chunk lexer.
+        const auto &utf8 = utf8_validation();
+        std::vector<TokenStream> parts(chunk_count);
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(chunk_count);
+            for(std::size_t i = 0; i < chunk_count; ++i) {
+                workers.emplace_back([this, &parts, &bounds, &utf8, i] {
+                    Lexer chunk{m_source, {}};
+                    chunk.m_sentinel = m_sentinel;
+                    chunk.m_pos = bounds[i];
+                    chunk.m_utf8 = utf8;
+                    chunk.tokenize_range_into(parts[i], bounds[i + 1]);
+                });
+            }
+        }
+
+        // ── Stitch: chunk 0 is exact; re-lex each seam until it syncs ────
+        out.clear();
+        out.set_file_id(options.file_id.value_or(m_file_id));
+        std::size_t total = 0;
+        for(const auto &part : parts) { total += part.size(); }
+        out.reserve(total);
+        out.append(parts[0]);
+
+        Lexer seam{m_source, {}};
+        seam.m_sentinel = m_sentinel;
+        seam.m_utf8 = utf8;
+        seam.m_pos = out.empty() ? bounds[0] : out.back().getEndOffset();
+        bool done = !out.empty() && out.back().getKind() == TokenKind::Eof;
+        std::size_t next = 1;
+        while(!done) {
+            const auto kind = seam.scan_next();
+            const auto start = seam.m_token_start;
+            // Chunks that lie entirely before this token were swallowed by a
+            // comment or literal: their speculation is useless.
+            while(next < chunk_count && start >= bounds[next + 1]) { ++next; }
+            if(next < chunk_count && start >= bounds[next]) {
+                const auto offsets = parts[next].offsets();
+                if(const auto it = std::ranges::lower_bound(offsets, C_UI32T(start)); it != offsets.end() && *it == start) {
+                    out.append(parts[next], C_ST(std::distance(offsets.begin(), it)));
+                    seam.m_pos = out.back().getEndOffset();
+                    done = out.back().getKind() == TokenKind::Eof;
+                    ++next;
+                    continue;
+                }
+            }
+            out.push_back(kind, C_UI32T(start), C_UI32T(seam.m_pos - start));
+            done = kind == TokenKind::Eof;
+        }
+        m_pos = seam.m_pos;
+
+        // Chunk lexers share no interner or literal table: re-scan the tagged
+        // tokens in source order instead, so ids come out as when sequential.
+        if(m_tables.interner != nullptr || m_tables.literals != nullptr || m_tables.strings != nullptr) {
+            Lexer rescan{m_source, {}};
+            rescan.m_sentinel = m_sentinel;
+            rescan.m_utf8 = utf8;
+            rescan.m_tables = m_tables;
+            const auto kinds = out.kinds();
+            const auto offsets = out.offsets();
+            for(std::size_t i = 0; i < out.size(); ++i) {
+                if(has_table_for(kinds[i])) {
+                    rescan.m_pos = offsets[i];
+                    [[maybe_unused]] const auto kind = rescan.scan_next();
+                    out.set_payload(i, rescan.m_payload);
+                }
+            }
+        }
+    }
+    // NOLINTEND(readability-function-cognitive-complexity)
+
+    RelexResult Lexer::relex(TokenStream &tokens, const TextEdit &edit, const std::string_view new_source, const LexTables &tables) {
+        Lexer lexer{new_source, {}};
+        lexer.m_tables = tables;
+        lexer.m_validate_utf8 = false;
+        lexer.check_compact_limit();
+        const auto kinds = tokens.kinds();
+        const auto offsets = tokens.offsets();
+        const auto lengths = tokens.lengths();
+
+        // Tokens that end (plus lookahead) before the edit are unaffected.
+        const auto unaffected = [&](const std::size_t i) { return C_ST(offsets[i]) + lengths[i] + max_lookahead <= edit.offset; };
+        const auto first = *std::ranges::partition_point(std::views::iota(std::size_t{0}, tokens.size()), unaffected);
+        if(first > 0) { lexer.m_pos = std::max(lexer.m_pos, C_ST(offsets[first - 1]) + lengths[first - 1]); }
+
+        const auto edit_end = edit.offset + edit.inserted;
+        TokenStream fresh;
+        std::size_t sync = tokens.size();
+        while(true) {
+            const auto kind = lexer.scan_next();
+            const auto start = lexer.m_token_start;
+            if(start >= edit_end) {
+                const auto old_start = start - edit.inserted + edit.removed;
+                const auto it = std::lower_bound(offsets.begin() + C_PTRDIFT(first), offsets.end(), old_start);
+                if(const auto idx = C_ST(std::distance(offsets.begin(), it));
+                   it != offsets.end() && *it == old_start && kinds[idx] == kind) {
+                    sync = idx;
+                    break;
+                }
+            }
+            fresh.push_back(kind, C_UI32T(start), C_UI32T(lexer.m_pos - start), lexer.m_payload);
+            if(kind == TokenKind::Eof) { break; }
+        }
 
-        if(is_at_end()) {
-            const auto loc = current_location();
-            return make_token(TokenKind::Eof, "", loc);
+        tokens.shift_offsets(sync, static_cast<std::int64_t>(edit.inserted) - static_cast<std::int64_t>(edit.removed));
+        tokens.replace(first, sync, fresh);
+        return {first, sync - first, fresh.size()};
+    }
+
+    std::size_t Lexer::estimated_token_count() const noexcept {
+        // One token per 8 bytes deliberately under-reserves: the vn_files
+        // samples average ~5 bytes per token, but growing once is cheaper
+        // than over-reserving for comment-heavy input.
+        return m_source.size() / 8 + 1;
+    }
+
+    bool Lexer::has_table_for(const TokenKind kind) const noexcept {
+        return (isIdentifier(kind) && m_tables.interner != nullptr) || (isNumericLiteral(kind) && m_tables.literals != nullptr) ||
+               (isTextLiteral(kind) && m_tables.strings != nullptr);
+    }
+
+    void Lexer::check_compact_limit() const {
+        if(m_source.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error(FORMAT("{}: source of {} bytes exceeds the 4 GiB compact token limit", m_file_path, m_source.size()));
         }
+    }
+
+    TokenRange Lexer::tokens() noexcept { return TokenRange{*this}; }
 
-        const auto start = current_location();
-        const auto first = C_UC(peek_byte());
+    TokenKind Lexer::scan_next() { return m_sentinel ? scan_token<SentinelInput>() : scan_token<CheckedInput>(); }
 
-        // ── Numeric literal ──────────────────────────────────────────────
-        if(std::isdigit(first) != 0) { return scan_numeric_literal(start); }
+    Token Lexer::next_token() {
+        const auto kind = scan_next();
+        return make_token(kind, m_token_start);
+    }
+
+    template <typename Input>
+    TokenKind Lexer::scan_token() {
+        skip_whitespace_and_comments<Input>();
+        m_token_start = m_pos;
+        m_payload = no_symbol;
+
+        if(is_at_end<Input>()) { return TokenKind::Eof; }
+
+        switch(token_start_table[C_UC(peek_byte<Input>())]) {
+        case TokenStart::Digit:
+            return scan_numeric_literal<Input>();
 
         // ── Leading-dot numeric: .5, .14, .0 (dot followed by digit) ────
-        if(first == '.' && std::isdigit(C_UC(peek_byte(1))) != 0) { return scan_numeric_literal(start); }
+        case TokenStart::Dot:
+            if(is_ascii_digit(peek_byte<Input>(1))) { return scan_numeric_literal<Input>(); }
+            return scan_operator_or_punctuation<Input>();
 
         // ── Hash-prefixed numeric (#b, #o, #x) ──────────────────────────
-        if(first == '#') { return scan_hash_numeric(start); }
+        case TokenStart::Hash:
+            return scan_hash_numeric<Input>();
 
         // ── String / char literals ───────────────────────────────────────
-        if(first == '"') { return scan_string_literal(start); }
-        if(first == '\'') { return scan_char_literal(start); }
+        case TokenStart::String:
+            return scan_string_literal<Input>();
+        case TokenStart::Char:
+            return scan_char_literal<Input>();
 
         // ── ASCII identifier / keyword ───────────────────────────────────
-        if((std::isalpha(first) != 0) || first == '_') { return scan_identifier_or_keyword(start, false); }
+        case TokenStart::Identifier:
+            return scan_identifier_or_keyword<Input>(false);
 
         // ── Non-ASCII: try Unicode identifier start ────────────────────────────
-        if(first > 0x7F) {
-            const auto res = unicode::decode_utf8(m_source, m_pos);
-            if(res.status == unicode::Utf8Status::Ok && unicode::is_id_start(res.codepoint)) {
-                return scan_identifier_or_keyword(start, true);
+        case TokenStart::NonAscii:
+            if(const auto res = decode_at(m_pos); res.status == unicode::Utf8Status::Ok && unicode::is_id_start(res.codepoint)) {
+                return scan_identifier_or_keyword<Input>(true);
             }
-        }
+            return scan_operator_or_punctuation<Input>();
 
-        // ── Operators / punctuation ──────────────────────────────────────
-        return scan_operator_or_punctuation(start);
+        // ── Operators / punctuation, and bytes that start no token ───────
+        case TokenStart::Operator:
+        case TokenStart::Other:
+        default:
+            return scan_operator_or_punctuation<Input>();
+        }
     }
-    bool Lexer::is_at_end() const noexcept { return m_pos >= m_source.size(); }
 
-    char Lexer::peek_byte(const std::size_t offset) const noexcept {
-        const auto idx = m_pos + offset;
-        return (idx < m_source.size()) ? m_source[idx] : '\0';
+    // =========================================================================
+    // TokenRange
+    // =========================================================================
+
+    TokenRange::TokenRange(Lexer &lexer) noexcept : m_lexer{&lexer} {}
+
+    void TokenRange::advance() {
+        if(m_current && m_current->getKind() == TokenKind::Eof) {
+            m_current.reset();
+            return;
+        }
+        m_current.emplace(m_lexer->next_token());
     }
 
-    char Lexer::advance_byte() noexcept {
-        const char c = m_source[m_pos++];
-        ++m_column;
-        return c;
+    template <typename Input> bool Lexer::is_at_end() const noexcept { return Input::at_end(m_source, m_pos); }
+
+    void Lexer::skip_bom() noexcept {
+        if(m_source.size() >= 3 && C_UC(m_source[0]) == 0xEFU && C_UC(m_source[1]) == 0xBBU && C_UC(m_source[2]) == 0xBFU) {
+            m_pos += 3;
+        }
     }
-    char32_t Lexer::peek_codepoint() const noexcept {
-        if(is_at_end()) { return U'\0'; }
-        return unicode::decode_utf8(m_source, m_pos).codepoint;
+
+    template <typename Input> char Lexer::peek_byte(const std::size_t offset) const noexcept { return Input::at(m_source, m_pos + offset); }
+
+    char Lexer::advance_byte() noexcept { return m_source[m_pos++]; }
+
+    void Lexer::advance_bytes_to(const std::size_t new_pos) noexcept { m_pos = new_pos; }
+
+    const unicode::Utf8Validation &Lexer::utf8_validation() {
+        if(!m_utf8) { m_utf8.emplace(unicode::validate_utf8(m_source)); }
+        return *m_utf8;
     }
-    char32_t Lexer::advance_codepoint() noexcept {
-        const auto res = unicode::decode_utf8(m_source, m_pos);
 
-        if(res.codepoint == U'\n') {
-            m_pos += res.byte_length;
-            ++m_line;
-            m_column = 1;
-        } else {
-            m_pos += res.byte_length;
-            m_column += res.byte_length;  // byte-based column counter
+    unicode::Utf8DecodeResult Lexer::decode_at(const std::size_t offset) {
+        // Every non-continuation byte outside the invalid ranges starts a
+        // well-formed sequence; continuation bytes are errors either way.
+        if(m_validate_utf8 && offset < m_source.size() && !unicode::detail::is_continuation(C_UI8T(m_source[offset])) &&
+           utf8_validation().is_valid_range(offset, offset + 1)) [[likely]] {
+            return unicode::decode_utf8_unchecked(m_source, offset);
         }
-        return res.codepoint;
+        return unicode::decode_utf8(m_source, offset);
     }
 
-    void Lexer::advance_with_utf8_check(bool &has_malformed) noexcept {
-        const auto res = unicode::decode_utf8(m_source, m_pos);
+    void Lexer::advance_with_utf8_check(bool &has_malformed) {
+        const auto res = decode_at(m_pos);
         if(res.status != unicode::Utf8Status::Ok) { has_malformed = true; }
         m_pos += res.byte_length;
-        m_column += res.byte_length;
-    }
-
-    SourceLocation Lexer::current_location() const noexcept { return SourceLocation{m_line, m_column, m_pos}; }
-
-    SourceSpan Lexer::make_span(const SourceLocation &start) const {
-        return SourceSpan{std::string_view{m_file_path}, start, current_location()};
     }
 
-    Token Lexer::make_token(const TokenKind kind, const std::string_view text, const SourceLocation &start) const {
-        return Token{kind, text, make_span(start)};
+    SourceLocation Lexer::resolve_location(const std::size_t offset) {
+        if(m_line_cursor.reaches(offset)) [[likely]] { return m_line_cursor.resolve(offset); }
+        if(!m_lines) { m_lines.emplace(m_source); }
+        return m_lines->resolve(offset, m_line_hint);
     }
 
-    Token Lexer::error_token(const std::string_view text, const SourceLocation &start) const {
-        return make_token(TokenKind::Error, text, start);
+    Token Lexer::make_token(const TokenKind kind, const std::size_t start) {
+        const auto start_location = resolve_location(start);
+        return Token{kind, current_text(start), SourceSpan{m_file_id, start_location, resolve_location(m_pos)}, m_payload};
     }
 
     std::string_view Lexer::current_text(const std::size_t text_start) const noexcept {
         return m_source.substr(text_start, m_pos - text_start);
     }
 
-    std::optional<Token> Lexer::try_two_char_token(const char c1, const char expected, const TokenKind kind, const std::size_t text_start,
-                                                   const SourceLocation &start) {
-        if(c1 == expected) {
-            advance_byte();
-            return make_token(kind, current_text(text_start), start);
-        }
-        return std::nullopt;
-    }
-
     // =========================================================================
     // Whitespace & comments
     // =========================================================================
 
-    bool Lexer::skip_unicode_whitespace() noexcept {
-        const auto res = unicode::decode_utf8(m_source, m_pos);
+    bool Lexer::skip_unicode_whitespace() {
+        const auto res = decode_at(m_pos);
         if(res.status != unicode::Utf8Status::Ok) { return false; }
 
-        // NEL (U+0085) is whitespace + line terminator (not in Zs/Zl/Zp categories)
-        if(res.codepoint == U'\u0085') {
-            m_pos += res.byte_length;
-            ++m_line;
-            m_column = 1;
-            return true;
-        }
-
-        if(!unicode::is_unicode_whitespace(res.codepoint)) { return false; }
-
-        // Line Separator / Paragraph Separator count as newlines
-        if(unicode::is_unicode_line_terminator(res.codepoint)) {
-            m_pos += res.byte_length;
-            ++m_line;
-            m_column = 1;
-        } else {
-            m_pos += res.byte_length;
-            m_column += res.byte_length;
-        }
+        // NEL (U+0085) is whitespace + line terminator (not in Zs/Zl/Zp categories);
+        // Line Separator / Paragraph Separator are in Zl/Zp. Line breaks are
+        // recorded by the LineIndex, so consuming the bytes is all that is left.
+        if(res.codepoint != U'\u0085' && !unicode::is_unicode_whitespace(res.codepoint)) { return false; }
+        m_pos += res.byte_length;
         return true;
     }
 
+    template <typename Input>
     void Lexer::skip_block_comment() {
         advance_byte();  // /
         advance_byte();  // *
-        while(!is_at_end()) {
-            if(peek_byte() == '*' && peek_byte(1) == '/') {
-                advance_byte();  // *
-                advance_byte();  // /
-                break;
-            }
-            advance_codepoint();
+        // The comment body is opaque, so no decode is needed.
+        advance_bytes_to(simd::find_block_comment_end(m_source, m_pos));
+        if(!is_at_end<Input>()) {
+            advance_byte();  // *
+            advance_byte();  // /
         }
     }
 
+    template <typename Input>
     void Lexer::skip_whitespace_and_comments() {
-        while(!is_at_end()) {
-            const char c = peek_byte();
+        while(!is_at_end<Input>()) {
+            const char c = peek_byte<Input>();
 
-            // Plain whitespace (ASCII: space, tab, CR, VT, FF)
+            // Plain whitespace (ASCII: space, tab, CR, VT, FF) — whole run at once
             if(is_ascii_horizontal_space(c)) {
-                advance_byte();
+                advance_bytes_to(simd::skip_horizontal_space(m_source, m_pos + 1));
                 continue;
             }
             if(c == '\n') {
-                advance_codepoint();  // handles line/column reset
+                advance_byte();
                 continue;
             }
 
             // Non-ASCII: check for Unicode whitespace (Zs, Zl, Zp categories) per FR-023
-            if(C_UC(c) > 0x7FU) {
+            if(has_char_class(c, CharClass::NonAscii)) {
                 if(skip_unicode_whitespace()) { continue; }
                 break;  // non-whitespace non-ASCII — let next_token() handle it
             }
 
             // Line comment: // …
-            if(c == '/' && peek_byte(1) == '/') {
-                advance_byte();
-                advance_byte();
-                while(!is_at_end() && peek_byte() != '\n') { advance_byte(); }
+            // The body is skipped in one search; the '\n' itself is left for the loop.
+            if(c == '/' && peek_byte<Input>(1) == '/') {
+                advance_bytes_to(simd::find_byte(m_source, m_pos + 2, '\n'));
                 continue;
             }
 
             // Block comment: /* … */  (non-nested)
-            if(c == '/' && peek_byte(1) == '*') {
-                skip_block_comment();
+            if(c == '/' && peek_byte<Input>(1) == '*') {
+                skip_block_comment<Input>();
                 continue;
             }
 
@@ -216,127 +436,214 @@ namespace jsv {
     // Identifier / keyword scanner
     // =========================================================================
 
-    Token Lexer::scan_identifier_or_keyword(const SourceLocation &start, bool seen_unicode) {
+    template <typename Input>
+    TokenKind Lexer::scan_identifier_or_keyword(bool seen_unicode) {
         const auto text_start = m_pos;
+        // Interner hash, folded in as the bytes are consumed.
+        auto hash = detail::symbol_hash_seed;
 
-        while(!is_at_end()) {
-            if(const auto first = C_UC(peek_byte()); first < 0x80) {
+        while(!is_at_end<Input>()) {
+            if(const auto first = peek_byte<Input>(); !has_char_class(first, CharClass::NonAscii)) {
                 // ASCII fast path
-                if((std::isalnum(first) != 0) || first == '_') {
-                    advance_byte();
+                if(is_ascii_ident_continue(first)) {
+                    hash = detail::symbol_hash_step(hash, advance_byte());
                 } else {
                     break;
                 }
             } else {
                 // Non-ASCII: decode and check XID_Continue
-                if(const auto cp = peek_codepoint(); unicode::is_id_continue(cp)) {
+                if(const auto res = decode_at(m_pos); unicode::is_id_continue(res.codepoint)) {
                     seen_unicode = true;
-                    advance_codepoint();
+                    for(std::uint8_t i = 0; i < res.byte_length; ++i) { hash = detail::symbol_hash_step(hash, advance_byte()); }
                 } else {
                     break;
                 }
             }
         }
 
-        const auto text = m_source.substr(text_start, m_pos - text_start);
-        const auto kind = classify_word(text);
-
-        if(kind == TokenKind::IdentifierAscii && seen_unicode) { return make_token(TokenKind::IdentifierUnicode, text, start); }
-        return make_token(kind, text, start);
+        const auto text = current_text(text_start);
+        auto kind = classify_word(text);
+        if(kind == TokenKind::IdentifierAscii && seen_unicode) { kind = TokenKind::IdentifierUnicode; }
+        if(m_tables.interner != nullptr && isIdentifier(kind)) { m_payload = m_tables.interner->intern(text, hash); }
+        return kind;
     }
 
     // =========================================================================
     // Numeric literal scanner
     // =========================================================================
 
-    void Lexer::try_scan_exponent() {
+    template <typename Input>
+    bool Lexer::try_scan_exponent(std::int64_t &exponent) {
         // Save position for potential rollback (R4: non-destructive lookahead)
         const auto saved_pos = m_pos;
-        const auto saved_col = m_column;
 
         // Consume 'e' or 'E'
-        if(is_at_end() || (peek_byte() != 'e' && peek_byte() != 'E')) { return; }
+        if(is_at_end<Input>() || (peek_byte<Input>() != 'e' && peek_byte<Input>() != 'E')) { return false; }
         advance_byte();
 
         // Consume optional sign
-        if(!is_at_end() && (peek_byte() == '+' || peek_byte() == '-')) { advance_byte(); }
+        const bool negative = peek_byte<Input>() == '-';
+        if(!is_at_end<Input>() && (peek_byte<Input>() == '+' || peek_byte<Input>() == '-')) { advance_byte(); }
 
         // Consume mandatory digits
-        if(is_at_end() || std::isdigit(C_UC(peek_byte())) == 0) {
+        if(is_at_end<Input>() || !is_ascii_digit(peek_byte<Input>())) {
             // Incomplete exponent: rollback to saved position
             m_pos = saved_pos;
-            m_column = saved_col;
-            return;
+            return false;
         }
 
-        // Valid exponent: consume all digits
-        while(!is_at_end() && std::isdigit(C_UC(peek_byte())) != 0) { advance_byte(); }
+        // Valid exponent: consume all digits, only skipping them without a
+        // literal table. Past 1e6 every double over- or underflows, so
+        // saturating keeps the value exact where it matters.
+        if(m_tables.literals == nullptr) {
+            while(!is_at_end<Input>() && is_ascii_digit(peek_byte<Input>())) { advance_byte(); }
+            return true;
+        }
+        std::int64_t value = 0;
+        while(!is_at_end<Input>() && is_ascii_digit(peek_byte<Input>())) {
+            value = std::min<std::int64_t>(value * 10 + (advance_byte() - '0'), 1'000'000);
+        }
+        exponent = negative ? -value : value;
+        return true;
     }
+    template <typename Input>
     bool Lexer::try_scan_width(const std::initializer_list<char> digits) {
         std::size_t off = 1;
         for(const char d : digits) {
-            if(peek_byte(off) != d) { return false; }
+            if(peek_byte<Input>(off) != d) { return false; }
             ++off;
         }
         // Width must not be followed by another digit (FR-017)
-        if(std::isdigit(C_UC(peek_byte(off))) != 0) { return false; }
+        if(is_ascii_digit(peek_byte<Input>(off))) { return false; }
         for(std::size_t i = 0; i <= digits.size(); ++i) { advance_byte(); }
         return true;
     }
 
+    template <typename Input>
     void Lexer::try_scan_type_suffix() {
-        if(is_at_end()) { return; }
-        const char s = peek_byte();
+        if(is_at_end<Input>()) { return; }
+        const char s = peek_byte<Input>();
 
         if(s == 'd' || s == 'D' || s == 'f' || s == 'F') {
+            m_literal.suffix = (s == 'd' || s == 'D') ? NumericSuffix::D : NumericSuffix::F;
             advance_byte();
             return;
         }
 
         if(s == 'u' || s == 'U' || s == 'i' || s == 'I') {
-            if(is_at_end() || std::isdigit(C_UC(peek_byte(1))) == 0) {
+            if(is_at_end<Input>() || !is_ascii_digit(peek_byte<Input>(1))) {
                 // Bare u/U/i/I — not consumed (FR-015)
                 return;
             }
 
             // Longest-match first to avoid partial consumption (32 before 3, etc.)
-            if(try_scan_width({'3', '2'})) { return; }
-            if(try_scan_width({'1', '6'})) { return; }
-            if(try_scan_width({'8'})) { return; }
+            const bool is_unsigned = s == 'u' || s == 'U';
+            if(try_scan_width<Input>({'3', '2'})) {
+                m_literal.suffix = is_unsigned ? NumericSuffix::U32 : NumericSuffix::I32;
+                return;
+            }
+            if(try_scan_width<Input>({'1', '6'})) {
+                m_literal.suffix = is_unsigned ? NumericSuffix::U16 : NumericSuffix::I16;
+                return;
+            }
+            if(try_scan_width<Input>({'8'})) {
+                m_literal.suffix = is_unsigned ? NumericSuffix::U8 : NumericSuffix::I8;
+                return;
+            }
             // Invalid width (e.g. 64, 80, 999) — do NOT consume anything
         }
     }
 
     // NOLINTBEGIN(readability-function-cognitive-complexity)
-    Token Lexer::scan_numeric_literal(const SourceLocation &start) {
-        const auto text_start = m_pos;
-
+    template <typename Input>
+    TokenKind Lexer::scan_numeric_literal() {
         // ── G1: Numeric part (mandatory) ────────────────────────────────────
         // Branch A: starts with digit (e.g., 42, 3., 3.14)
         // Branch B: starts with dot followed by digit (e.g., .5, .14) - handled by next_token()
-        if(std::isdigit(C_UC(peek_byte())) != 0) {
+        // With a literal table, every digit is folded into `mantissa` as it is
+        // consumed and fractional digits lower the decimal exponent; without
+        // one, digits are only skipped.
+        m_literal = NumericLiteral{};
+        const bool decode = m_tables.literals != nullptr;
+        std::uint64_t mantissa = 0;
+        std::int64_t exponent = 0;
+        const auto consume_digits = [&](const bool fraction) {
+            if(!decode) {
+                while(!is_at_end<Input>() && is_ascii_digit(peek_byte<Input>())) { advance_byte(); }
+                return;
+            }
+            while(!is_at_end<Input>() && is_ascii_digit(peek_byte<Input>())) {
+                const auto digit = C_UI(advance_byte() - '0');
+                if(const auto next = detail::accumulate_digit(mantissa, 10, digit, m_literal.overflow); !m_literal.overflow) {
+                    mantissa = next;
+                    exponent -= fraction ? 1 : 0;
+                } else if(!fraction) {
+                    ++exponent;  // integer digit past 64 bits: only its magnitude is kept
+                }
+            }
+        };
+        if(is_ascii_digit(peek_byte<Input>())) {
             // Consume integer digits
-            while(!is_at_end() && std::isdigit(C_UC(peek_byte())) != 0) { advance_byte(); }
+            consume_digits(false);
 
             // Consume optional trailing dot (FR-003: trailing dot IS included)
-            if(!is_at_end() && peek_byte() == '.') {
+            if(!is_at_end<Input>() && peek_byte<Input>() == '.') {
                 advance_byte();
+                m_literal.is_float = true;
                 // Consume fractional digits (optional)
-                while(!is_at_end() && std::isdigit(C_UC(peek_byte())) != 0) { advance_byte(); }
+                consume_digits(true);
             }
-        } else if(peek_byte() == '.' && !is_at_end() && std::isdigit(C_UC(peek_byte(1))) != 0) {
+        } else if(peek_byte<Input>() == '.' && !is_at_end<Input>() && is_ascii_digit(peek_byte<Input>(1))) {
             // Branch B: leading dot followed by digits
             advance_byte();  // consume '.'
-            while(!is_at_end() && std::isdigit(C_UC(peek_byte())) != 0) { advance_byte(); }
+            m_literal.is_float = true;
+            consume_digits(true);
         }
 
         // ── G2: Optional exponent ───────────────────────────────────────────
-        try_scan_exponent();
+        if(std::int64_t exponent_part = 0; try_scan_exponent<Input>(exponent_part)) {
+            m_literal.is_float = true;
+            exponent += exponent_part;
+        }
 
         // ── G3: Optional type suffix ────────────────────────────────────────
-        try_scan_type_suffix();
+        const auto value_end = m_pos;
+        try_scan_type_suffix<Input>();
+
+        if(decode) {
+            m_literal.is_float = m_literal.is_float || m_literal.suffix == NumericSuffix::F || m_literal.suffix == NumericSuffix::D;
+            if(m_literal.is_float) {
+                decode_decimal_float(value_end, mantissa, exponent);
+            } else {
+                m_literal.integer = mantissa;
+            }
+            record_literal();
+        }
+        return TokenKind::Numeric;
+    }
+
+    void Lexer::decode_decimal_float(const std::size_t end, const std::uint64_t mantissa, const std::int64_t exponent) {
+        if(!m_literal.overflow && detail::decimal_to_double_fast(mantissa, exponent, m_literal.real)) { return; }
+        // More than 19 significant digits or a large exponent: parse the text
+        // with the correctly rounded `std::from_chars`. The saturated exponent
+        // tells overflow from underflow when the value is out of range.
+        m_literal.overflow = false;
+        const auto text = m_source.substr(m_token_start, end - m_token_start);
+        if(const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), m_literal.real);
+           ec == std::errc::result_out_of_range) {
+            m_literal.overflow = true;
+            m_literal.real = exponent > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+        }
+    }
+
+    void Lexer::record_literal() {
+        if(m_tables.literals != nullptr) { m_payload = m_tables.literals->add(m_literal); }
+    }
 
-        return make_token(TokenKind::Numeric, m_source.substr(text_start, m_pos - text_start), start);
+    void Lexer::record_text(const std::size_t body_start, const std::size_t body_end, const bool escaped, const bool is_char) {
+        if(m_tables.strings == nullptr) { return; }
+        const auto body = m_source.substr(body_start, body_end - body_start);
+        m_payload = is_char ? m_tables.strings->add_char(body, escaped) : m_tables.strings->add_string(body, escaped);
     }
     // NOLINTEND(readability-function-cognitive-complexity)
 
@@ -344,38 +651,52 @@ namespace jsv {
 
     constexpr bool Lexer::is_octal_digit(const char c) noexcept { return c >= '0' && c <= '7'; }
 
-    bool Lexer::is_hex_digit(const char c) noexcept { return std::isxdigit(C_UC(c)) != 0; }
+    constexpr bool Lexer::is_hex_digit(const char c) noexcept { return is_ascii_hex_digit(c); }
 
     // =========================================================================
     // Hash-prefixed numeric scanner  (#b, #o, #x)
     // =========================================================================
-    template <typename IsDigit>
-    Token Lexer::scan_based_literal(const std::size_t text_start, const SourceLocation &start, const TokenKind kind, IsDigit is_digit) {
-        if(is_at_end() || !is_digit(peek_byte())) { return error_token(m_source.substr(text_start, m_pos - text_start), start); }
-        while(!is_at_end() && (is_digit(peek_byte()) || peek_byte() == '_')) { advance_byte(); }
-        if(!is_at_end() && (peek_byte() == 'u' || peek_byte() == 'U') && (std::isalnum(C_UC(peek_byte(1))) == 0)) { advance_byte(); }
-        return make_token(kind, m_source.substr(text_start, m_pos - text_start), start);
+    template <typename Input, unsigned Base, typename IsDigit>
+    TokenKind Lexer::scan_based_literal(const TokenKind kind, IsDigit is_digit) {
+        if(is_at_end<Input>() || !is_digit(peek_byte<Input>())) { return TokenKind::Error; }
+        m_literal = NumericLiteral{.base = C_UI8T(Base)};
+        const auto in_literal = [&] { return !is_at_end<Input>() && (is_digit(peek_byte<Input>()) || peek_byte<Input>() == '_'); };
+        if(m_tables.literals == nullptr) {
+            while(in_literal()) { advance_byte(); }
+        } else {
+            while(in_literal()) {
+                if(const char c = advance_byte(); c != '_') {
+                    m_literal.integer = detail::accumulate_digit(m_literal.integer, Base, hex_digit_value(c), m_literal.overflow);
+                }
+            }
+        }
+        if(!is_at_end<Input>() && (peek_byte<Input>() == 'u' || peek_byte<Input>() == 'U') && !is_ascii_alnum(peek_byte<Input>(1))) {
+            advance_byte();
+            m_literal.suffix = NumericSuffix::U;
+        }
+        record_literal();
+        return kind;
     }
 
     // NOLINTBEGIN(readability-function-cognitive-complexity)
-    Token Lexer::scan_hash_numeric(const SourceLocation &start) {
-        const auto text_start = m_pos;
+    template <typename Input>
+    TokenKind Lexer::scan_hash_numeric() {
         advance_byte();  // consume '#'
 
-        if(is_at_end()) { return error_token(m_source.substr(text_start, m_pos - text_start), start); }
+        if(is_at_end<Input>()) { return TokenKind::Error; }
 
-        const char tag = peek_byte();
+        const char tag = peek_byte<Input>();
         advance_byte();  // consume tag
 
         switch(tag) {
         case 'b':
-            return scan_based_literal(text_start, start, TokenKind::Binary, is_binary_digit);
+            return scan_based_literal<Input, 2>(TokenKind::Binary, is_binary_digit);
         case 'o':
-            return scan_based_literal(text_start, start, TokenKind::Octal, is_octal_digit);
+            return scan_based_literal<Input, 8>(TokenKind::Octal, is_octal_digit);
         case 'x':
-            return scan_based_literal(text_start, start, TokenKind::Hexadecimal, is_hex_digit);
+            return scan_based_literal<Input, 16>(TokenKind::Hexadecimal, is_hex_digit);
         default:
-            return error_token(m_source.substr(text_start, m_pos - text_start), start);
+            return TokenKind::Error;
         }
     }
     // NOLINTEND(readability-function-cognitive-complexity)
@@ -384,63 +705,82 @@ namespace jsv {
     // String / char literal scanners
     // =========================================================================
 
+    template <typename Input>
     void Lexer::skip_escape() {
-        if(is_at_end()) { return; }
+        if(is_at_end<Input>()) { return; }
         // Unicode escapes consume additional hex digits
         if(const char c = advance_byte(); c == 'u') {
-            for(int i = 0; i < 4 && !is_at_end() && (std::isxdigit(C_UC(peek_byte())) != 0); ++i) { advance_byte(); }
+            for(int i = 0; i < 4 && !is_at_end<Input>() && is_ascii_hex_digit(peek_byte<Input>()); ++i) { advance_byte(); }
         } else if(c == 'U') {
-            for(int i = 0; i < 8 && !is_at_end() && (std::isxdigit(C_UC(peek_byte())) != 0); ++i) { advance_byte(); }
+            for(int i = 0; i < 8 && !is_at_end<Input>() && is_ascii_hex_digit(peek_byte<Input>()); ++i) { advance_byte(); }
         }
         // All other escapes (\\, \n, \t, \r, \", \', \0) fully consumed above.
     }
 
-    Token Lexer::scan_string_literal(const SourceLocation &start) {
-        const auto text_start = m_pos;
+    template <typename Input>
+    TokenKind Lexer::scan_string_literal() {
         advance_byte();  // opening '"'
+        const auto body_start = m_pos;
+        auto body_end = m_source.size();
         bool has_malformed = false;
+        bool has_escape = false;
+
+        while(!is_at_end<Input>()) {
+            // Skip the plain run up to the next quote, backslash or line break in
+            // one step. Multi-byte sequences never contain ASCII bytes, so the run
+            // holds only whole (or truncated) sequences and can be validated as a
+            // unit (FR-021) instead of decoding byte by byte. A run starting on a
+            // sequence start is checked against the whole-source validation,
+            // unless that is off (`relex`).
+            const auto run = simd::scan_string_body(m_source, m_pos);
+            if(run.has_non_ascii) {
+                const auto body = m_source.substr(m_pos, run.end - m_pos);
+                const bool valid = !m_validate_utf8 || unicode::detail::is_continuation(C_UI8T(body.front()))
+                                       ? unicode::is_valid_utf8(body)
+                                       : utf8_validation().is_valid_range(m_pos, run.end);
+                has_malformed = has_malformed || !valid;
+            }
+            advance_bytes_to(run.end);
+            if(is_at_end<Input>()) { break; }
 
-        while(!is_at_end()) {
-            const char c = peek_byte();
+            const char c = peek_byte<Input>();
             if(c == '"') {
+                body_end = m_pos;
                 advance_byte();  // closing '"'
                 break;
             }
             if(c == '\\') {
                 advance_byte();  // '\'
-                skip_escape();
+                skip_escape<Input>();
+                has_escape = true;
                 continue;
             }
-            if(c == '\n' || c == '\r') {
-                // Unterminated single-line string — stop and let the parser reject.
-                break;
-            }
-            // For non-ASCII bytes, validate the UTF-8 sequence (FR-021)
-            if(C_UC(c) > 0x7F) {
-                advance_with_utf8_check(has_malformed);
-            } else {
-                advance_byte();
-            }
+            // '\n' or '\r': unterminated single-line string — stop and let the parser reject.
+            body_end = m_pos;
+            break;
         }
 
-        const auto text = m_source.substr(text_start, m_pos - text_start);
-        if(has_malformed) { return error_token(text, start); }
-        return make_token(TokenKind::StringLiteral, text, start);
+        if(has_malformed) { return TokenKind::Error; }
+        record_text(body_start, body_end, has_escape, false);
+        return TokenKind::StringLiteral;
     }
 
-    Token Lexer::scan_char_literal(const SourceLocation &start) {
-        const auto text_start = m_pos;
+    template <typename Input>
+    TokenKind Lexer::scan_char_literal() {
         advance_byte();  // opening '\''
+        const auto body_start = m_pos;
         bool has_malformed = false;
+        bool has_escape = false;
 
-        if(!is_at_end()) {
-            if(peek_byte() == '\\') {
+        if(!is_at_end<Input>()) {
+            if(peek_byte<Input>() == '\\') {
                 advance_byte();  // '\'
-                skip_escape();
+                skip_escape<Input>();
+                has_escape = true;
             } else {
                 // For non-ASCII bytes, validate the UTF-8 sequence (FR-021)
-                const char c = peek_byte();
-                if(C_UC(c) > 0x7F) {
+                const char c = peek_byte<Input>();
+                if(has_char_class(c, CharClass::NonAscii)) {
                     advance_with_utf8_check(has_malformed);
                 } else {
                     advance_byte();
@@ -448,151 +788,41 @@ namespace jsv {
             }
         }
 
-        if(!is_at_end() && peek_byte() == '\'') { advance_byte(); }  // closing '\''
+        const auto body_end = m_pos;
+        if(!is_at_end<Input>() && peek_byte<Input>() == '\'') { advance_byte(); }  // closing '\''
 
-        const auto text = m_source.substr(text_start, m_pos - text_start);
-        if(has_malformed) { return error_token(text, start); }
-        return make_token(TokenKind::CharLiteral, text, start);
+        if(has_malformed) { return TokenKind::Error; }
+        record_text(body_start, body_end, has_escape, true);
+        return TokenKind::CharLiteral;
     }
 
     // =========================================================================
     // Operator / punctuation scanner
     // =========================================================================
 
-    // NOLINTBEGIN(readability-function-cognitive-complexity)
-    Token Lexer::scan_operator_or_punctuation(const SourceLocation &start) {
-        const auto text_start = m_pos;
-        const char c0 = advance_byte();
-        const char c1 = peek_byte();
-
-        switch(c0) {
-        case '+':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::PlusEqual, text_start, start)) { return *t; }
-            if(auto t = try_two_char_token(c1, '+', TokenKind::PlusPlus, text_start, start)) { return *t; }
-            return make_token(TokenKind::Plus, current_text(text_start), start);
-
-        case '-':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::MinusEqual, text_start, start)) { return *t; }
-            if(auto t = try_two_char_token(c1, '-', TokenKind::MinusMinus, text_start, start)) { return *t; }
-            return make_token(TokenKind::Minus, current_text(text_start), start);
-
-        case '=':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::EqualEqual, text_start, start)) { return *t; }
-            return make_token(TokenKind::Equal, current_text(text_start), start);
-
-        case '!':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::NotEqual, text_start, start)) { return *t; }
-            return make_token(TokenKind::Not, current_text(text_start), start);
-
-        case '<':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::LessEqual, text_start, start)) { return *t; }
-            if(auto t = try_two_char_token(c1, '<', TokenKind::ShiftLeft, text_start, start)) { return *t; }
-            return make_token(TokenKind::Less, current_text(text_start), start);
-
-        case '>':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::GreaterEqual, text_start, start)) { return *t; }
-            if(auto t = try_two_char_token(c1, '>', TokenKind::ShiftRight, text_start, start)) { return *t; }
-            return make_token(TokenKind::Greater, current_text(text_start), start);
-
-        case '|':
-            if(auto t = try_two_char_token(c1, '|', TokenKind::OrOr, text_start, start)) { return *t; }
-            return make_token(TokenKind::Or, current_text(text_start), start);
-
-        case '&':
-            if(auto t = try_two_char_token(c1, '&', TokenKind::AndAnd, text_start, start)) { return *t; }
-            return make_token(TokenKind::And, current_text(text_start), start);
-
-        case '%':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::PercentEqual, text_start, start)) { return *t; }
-            return make_token(TokenKind::Percent, current_text(text_start), start);
-
-        case '^':
-            if(auto t = try_two_char_token(c1, '=', TokenKind::XorEqual, text_start, start)) { return *t; }
-            return make_token(TokenKind::Xor, current_text(text_start), start);
-
-        case '*':
-            return make_token(TokenKind::Star, current_text(text_start), start);
-        case '/':
-            return make_token(TokenKind::Slash, current_text(text_start), start);
-        case ':':
-            return make_token(TokenKind::Colon, current_text(text_start), start);
-        case ',':
-            return make_token(TokenKind::Comma, current_text(text_start), start);
-        case '.':
-            return make_token(TokenKind::Dot, current_text(text_start), start);
-        case ';':
-            return make_token(TokenKind::Semicolon, current_text(text_start), start);
-        case '(':
-            return make_token(TokenKind::OpenParen, current_text(text_start), start);
-        case ')':
-            return make_token(TokenKind::CloseParen, current_text(text_start), start);
-        case '[':
-            return make_token(TokenKind::OpenBracket, current_text(text_start), start);
-        case ']':
-            return make_token(TokenKind::CloseBracket, current_text(text_start), start);
-        case '{':
-            return make_token(TokenKind::OpenBrace, current_text(text_start), start);
-        case '}':
-            return make_token(TokenKind::CloseBrace, current_text(text_start), start);
+    template <typename Input>
+    TokenKind Lexer::scan_operator_or_punctuation() {
+        // Longest match through the operator trie in `Operators.hpp`.
+        if(const auto match = match_operator(peek_byte<Input>(), peek_byte<Input>(1)); match.length != 0) {
+            m_pos += match.length;
+            return match.kind;
+        }
 
-        default:
-            // Gracefully consume unknown UTF-8 sequences (first byte already advanced).
-            if(C_UC(c0) > 0x7F) {
-                const auto seq = unicode::decode_utf8(m_source, text_start);
-                for(std::size_t i = 1; i < seq.byte_length && !is_at_end(); ++i) { advance_byte(); }
-            }
-            return error_token(current_text(text_start), start);
+        // Gracefully consume unknown UTF-8 sequences as one Error token.
+        const auto text_start = m_pos;
+        advance_byte();
+        if(has_char_class(m_source[text_start], CharClass::NonAscii)) {
+            const auto seq = decode_at(text_start);
+            for(std::size_t i = 1; i < seq.byte_length && !is_at_end<Input>(); ++i) { advance_byte(); }
         }
+        return TokenKind::Error;
     }
-    // NOLINTEND(readability-function-cognitive-complexity)
 
     // =========================================================================
     // Keyword / type classification
     // =========================================================================
 
-    TokenKind Lexer::classify_word(const std::string_view text) noexcept {
-        using namespace std::string_view_literals;
-
-        // Replace inside TokenKind Lexer::classify_word(...)
-        static constexpr std::array<std::pair<std::string_view, TokenKind>, 25> kTable{{
-            {"bool"sv, TokenKind::KeywordBool},
-            {"break"sv, TokenKind::KeywordBreak},
-            {"char"sv, TokenKind::TypeChar},
-            {"const"sv, TokenKind::KeywordConst},
-            {"continue"sv, TokenKind::KeywordContinue},
-            {"else"sv, TokenKind::KeywordElse},
-            {"f32"sv, TokenKind::TypeF32},
-            {"f64"sv, TokenKind::TypeF64},
-            {"for"sv, TokenKind::KeywordFor},
-            {"fun"sv, TokenKind::KeywordFun},
-            {"i16"sv, TokenKind::TypeI16},
-            {"i32"sv, TokenKind::TypeI32},
-            {"i64"sv, TokenKind::TypeI64},
-            {"i8"sv, TokenKind::TypeI8},
-            {"if"sv, TokenKind::KeywordIf},
-            {"main"sv, TokenKind::KeywordMain},
-            {"nullptr"sv, TokenKind::KeywordNullptr},
-            {"return"sv, TokenKind::KeywordReturn},
-            {"string"sv, TokenKind::TypeString},
-            {"u16"sv, TokenKind::TypeU16},
-            {"u32"sv, TokenKind::TypeU32},
-            {"u64"sv, TokenKind::TypeU64},
-            {"u8"sv, TokenKind::TypeU8},
-            {"var"sv, TokenKind::KeywordVar},
-            {"while"sv, TokenKind::KeywordWhile},
-        }};
-        static_assert(
-            []() consteval {
-                for(std::size_t i = 1; i < kTable.size(); ++i) {
-                    if(kTable[i - 1].first >= kTable[i].first) { return false; }
-                }
-                return true;
-            }(),
-            "kTable must be sorted lexicographically for lower_bound to be correct");
-        const auto it = std::ranges::lower_bound(kTable, text, {}, &std::pair<std::string_view, TokenKind>::first);
-        if(it != kTable.end() && it->first == text) { return it->second; }
-        return TokenKind::IdentifierAscii;
-    }
+    TokenKind Lexer::classify_word(const std::string_view text) noexcept { return classify_keyword(text); }
 
 }  // namespace jsv
 // clang-format off
@@ -0,0 +1,71 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/LineIndex.hpp"
+#include "jsav/lexer/simd/ByteScan.hpp"
+
+namespace jsv {
+
+    LineIndex::LineIndex() : m_line_starts{0} {}
+
+    LineIndex::LineIndex(std::string_view text) : m_line_starts{0}, m_text_size{text.size()} {
+        std::size_t pos = 0;
+        while((pos = simd::find_line_break_candidate(text, pos)) < text.size()) {
+            if(const auto len = detail::line_terminator_length(text, pos); len != 0) {
+                pos += len;
+                m_line_starts.push_back(pos);
+            } else {
+                ++pos;
+            }
+        }
+    }
+
+    bool LineIndex::line_contains(const std::size_t line, const std::size_t offset) const noexcept {
+        return line < m_line_starts.size() && m_line_starts[line] <= offset &&
+               (line + 1 == m_line_starts.size() || offset < m_line_starts[line + 1]);
+    }
+
+    SourceLocation LineIndex::resolve(std::size_t offset) const noexcept {
+        std::size_t hint = 0;
+        return resolve(offset, hint);
+    }
+
+    SourceLocation LineIndex::resolve(std::size_t offset, std::size_t &hint) const noexcept {
+        offset = std::min(offset, m_text_size);
+        if(!line_contains(hint, offset)) {
+            if(line_contains(hint + 1, offset)) {
+                ++hint;
+            } else {
+                const auto it = std::ranges::upper_bound(m_line_starts, offset);
+                hint = C_ST(std::distance(m_line_starts.begin(), it)) - 1;
+            }
+        }
+        return SourceLocation{hint + 1, offset - m_line_starts[hint] + 1, offset};
+    }
+
+    SourceLocation LineCursor::resolve(std::size_t offset) noexcept {
+        offset = std::min(offset, m_text.size());
+        // Candidates are searched only up to `offset`, so a long line is not
+        // rescanned for every token on it.
+        const auto before = m_text.substr(0, offset);
+        std::size_t pos = m_scanned;
+        while(pos < offset && (pos = simd::find_line_break_candidate(before, pos)) < offset) {
+            const auto len = detail::line_terminator_length(m_text, pos);
+            if(len == 0) {
+                ++pos;
+                continue;
+            }
+            // A terminator that `offset` falls inside still belongs to its line.
+            if(pos + len > offset) { break; }
+            pos += len;
+            ++m_line;
+            m_line_start = pos;
+        }
+        m_scanned = std::max(m_scanned, std::min(pos, offset));
+        return SourceLocation{m_line, offset - m_line_start + 1, offset};
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,42 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/SourceFile.hpp"
+
+namespace jsv {
+
+    SourceFile::SourceFile(std::string_view text, std::string path, const FileId id)
+      : m_text{text}, m_path{vnd_move(path)}, m_id{id}, m_lines{text} {}
+
+    std::string_view SourceFile::text_of(const CompactToken &token) const noexcept {
+        // A token of another file may lie past the end of this text.
+        if(token.getFileId() != m_id || std::size_t{token.getOffset()} + token.getLength() > m_text.size()) { return {}; }
+        return m_text.substr(token.getOffset(), token.getLength());
+    }
+
+    SourceLocation SourceFile::location(const std::size_t offset) const noexcept { return m_lines.resolve(offset); }
+
+    SourceSpan SourceFile::span_of(const CompactToken &token) const noexcept {
+        std::size_t hint = 0;
+        const auto start = m_lines.resolve(token.getOffset(), hint);
+        return SourceSpan{m_id, start, m_lines.resolve(token.getEndOffset(), hint)};
+    }
+
+    Token SourceFile::materialize(const CompactToken &token) const noexcept {
+        return Token{token.getKind(), text_of(token), span_of(token), token.getPayload()};
+    }
+
+    TokenView SourceFile::view(const CompactToken &token) const noexcept { return TokenView{token, *this}; }
+
+    // -------------------------------------------------------------------------
+    // TokenView
+    // -------------------------------------------------------------------------
+
+    std::string TokenView::to_string() const { return m_source->materialize(m_token).to_string(m_source->path()); }
+
+    std::ostream &operator<<(std::ostream &os, const TokenView &token) { return os << token.to_string(); }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
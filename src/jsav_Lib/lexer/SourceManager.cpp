@@ -0,0 +1,51 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/SourceManager.hpp"
+
+namespace jsv {
+
+    FileId SourceManager::load(const std::string_view path) { return add(std::string{path}, vnd::SourceBuffer::from_file(path)); }
+
+    std::vector<std::expected<FileId, FileReadError>> SourceManager::load_all(const std::span<const std::string> paths, const std::size_t threads) {
+        auto buffers = vnd::SourceBuffer::from_files(paths, threads);
+        std::vector<std::expected<FileId, FileReadError>> ids;
+        ids.reserve(buffers.size());
+        for(std::size_t i = 0; i < buffers.size(); ++i) {
+            if(buffers[i]) {
+                ids.emplace_back(add(paths[i], vnd_move_always(*buffers[i])));
+            } else {
+                ids.emplace_back(std::unexpect, vnd_move_always(buffers[i].error()));
+            }
+        }
+        return ids;
+    }
+
+    FileId SourceManager::add(std::string path, vnd::SourceBuffer buffer) {
+        if(const auto known = m_by_path.find(path); known != m_by_path.end() && text(known->second) == buffer.text()) {
+            return known->second;
+        }
+        if(m_entries.size() >= max_files) { throw std::length_error(FORMAT("{}: more than {} sources", path, max_files)); }
+        const auto id = static_cast<FileId>(m_entries.size());
+        const auto hash = std::hash<std::string_view>{}(buffer.text());
+        std::shared_ptr<const vnd::SourceBuffer> shared;
+        for(auto [it, last] = m_by_hash.equal_range(hash); it != last; ++it) {
+            if(text(it->second) == buffer.text()) {
+                shared = m_entries[it->second].buffer;
+                ++m_duplicates;
+                break;
+            }
+        }
+        if(!shared) {
+            shared = std::make_shared<const vnd::SourceBuffer>(vnd_move(buffer));
+            m_by_hash.emplace(hash, id);
+        }
+        m_entries.emplace_back(vnd_move(shared), path, id);
+        m_by_path.insert_or_assign(vnd_move(path), id);
+        return id;
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -7,44 +7,16 @@
 
 namespace jsv {
 
-    // -------------------------------------------------------------------------
-    // Mutation
-    // -------------------------------------------------------------------------
-
-    void SourceSpan::merge(const SourceSpan &other) noexcept {
-        if(file_path == other.file_path) {
-            if(other.start < start) { start = other.start; }
-            if(other.end > end) { end = other.end; }
-        }
-    }
-
-    // -------------------------------------------------------------------------
-    // Immutable merge
-    // -------------------------------------------------------------------------
-
-    std::optional<SourceSpan> SourceSpan::merged(const SourceSpan &other) const {
-        if(file_path != other.file_path) { return std::nullopt; }
-        return SourceSpan{file_path, (start < other.start) ? start : other.start, (end > other.end) ? end : other.end};
-    }
-
-    // -------------------------------------------------------------------------
-    // Ordering
-    // -------------------------------------------------------------------------
-
-    std::strong_ordering SourceSpan::operator<=>(const SourceSpan &other) const noexcept {
-        if(auto cmp = file_path <=> other.file_path; cmp != 0) { return cmp; }
-        if(auto cmp = start <=> other.start; cmp != 0) { return cmp; }
-        return end <=> other.end;
-    }
-
-    bool SourceSpan::operator==(const SourceSpan &other) const noexcept { return (*this <=> other) == std::strong_ordering::equal; }
-
     // -------------------------------------------------------------------------
     // Formatting — single source of truth used by all formatters
     // -------------------------------------------------------------------------
 
     std::string SourceSpan::to_string() const {
-        const auto truncated = truncate_path(std::filesystem::path{file_path}, 2);
+        return fmt::format("<file {}>:line {}:column {} - line {}:column {}", file_id, start.line, start.column, end.line, end.column);
+    }
+
+    std::string SourceSpan::to_string(const std::string_view path) const {
+        const auto truncated = truncate_path(std::filesystem::path{path}, 2);
         return fmt::format("{}:line {}:column {} - line {}:column {}", truncated, start.line, start.column, end.line, end.column);
     }
 
@@ -81,7 +53,7 @@ namespace std {
 
     std::size_t hash<jsv::SourceSpan>::operator()(const jsv::SourceSpan &s) const noexcept {
         std::size_t seed = 0;
-        hash_combine(seed, std::hash<std::string_view>{}(s.file_path));
+        hash_combine(seed, std::hash<jsv::FileId>{}(s.file_id));
         hash_combine(seed, std::hash<jsv::SourceLocation>{}(s.start));
         hash_combine(seed, std::hash<jsv::SourceLocation>{}(s.end));
         return seed;
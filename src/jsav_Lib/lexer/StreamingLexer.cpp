@@ -0,0 +1,170 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/StreamingLexer.hpp"
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace jsv {
+
+    StreamingLexer::StreamingLexer(Reader read, std::string name, const StreamLexOptions &options)
+      : m_read{vnd_move(read)}, m_name{vnd_move(name)},
+        m_options{std::max<std::size_t>(options.window_bytes, 1), std::max<std::size_t>(options.max_token_bytes, 1)},
+        // A kept token plus its lookahead never takes more than `max_token_bytes
+        // + max_lookahead`, so every refill has room for a full window.
+        m_capacity{m_options.window_bytes + m_options.max_token_bytes + Lexer::max_lookahead},
+        m_buffer{std::make_unique_for_overwrite<char[]>(m_capacity + vnd::SourceBuffer::padding)} {}
+
+    StreamingLexer::StreamingLexer(std::istream &input, std::string name, const StreamLexOptions &options)
+      : StreamingLexer{[&input, name](char *buffer, const std::size_t size) {
+                           input.read(buffer, static_cast<std::streamsize>(size));
+                           if(input.bad()) { throw FILEREADEREERRORF("Unable to read file: {}. Reason: stream error", name); }
+                           return C_ST(input.gcount());
+                       },
+                       name, options} {}
+
+#ifndef _WIN32
+    StreamingLexer::StreamingLexer(const int fd, std::string name, const StreamLexOptions &options)
+      : StreamingLexer{[fd, name](char *buffer, const std::size_t size) {
+                           while(true) {
+                               const auto got = ::read(fd, buffer, size);
+                               if(got >= 0) { return C_ST(got); }
+                               if(errno != EINTR) {
+                                   throw FILEREADEREERRORF("Unable to read file: {}. Reason: {}", name, std::generic_category().message(errno));
+                               }
+                           }
+                       },
+                       name, options} {}
+#endif
+
+    void StreamingLexer::refill() {
+        // PERF: only the unlexed tail is moved — at most one token plus lookahead.
+        const auto kept = m_end - m_pos;
+        std::memmove(m_buffer.get(), m_buffer.get() + m_pos, kept);
+        m_base += m_pos;
+        m_pos = 0;
+        m_end = kept;
+        // Stop at a short read too: with a pipelined reader the rest is still
+        // in flight, and the bytes at hand can be lexed meanwhile.
+        while(!m_eof && m_end < m_capacity) {
+            const auto wanted = m_capacity - m_end;
+            const auto got = m_read(m_buffer.get() + m_end, wanted);
+            m_end += got;
+            m_eof = got == 0;
+            if(got < wanted) { break; }
+        }
+        std::memset(m_buffer.get() + m_end, 0, vnd::SourceBuffer::padding);
+        m_window.emplace(std::string_view{m_buffer.get(), m_end}, m_name);
+        m_window->m_sentinel = true;
+    }
+
+    void StreamingLexer::skip_trivia() {
+        // Mirrors `Lexer::skip_whitespace_and_comments`, except that a comment
+        // reaching the end of the window is left open in `m_comment` instead
+        // of being kept in the buffer.
+        while(true) {
+            const std::string_view text{m_buffer.get(), m_end};
+            if(m_comment == OpenComment::Line) {
+                m_pos = simd::find_byte(text, m_pos, '\n');
+                if(m_pos < m_end) { m_comment = OpenComment::None; }
+            } else if(m_comment == OpenComment::Block) {
+                const auto close = simd::find_block_comment_end(text, m_pos);
+                if(close < m_end) {
+                    m_pos = close + 2;
+                    m_comment = OpenComment::None;
+                } else {
+                    // The final '*' may be closed by the next window's first byte.
+                    m_pos = std::max(m_pos, m_end - 1);
+                    if(m_eof) { m_pos = m_end; }
+                }
+            }
+            if(m_comment != OpenComment::None || m_pos == m_end) {
+                if(m_eof) { return; }
+                refill();
+                continue;
+            }
+
+            const char c = text[m_pos];
+            if(is_ascii_horizontal_space(c)) {
+                m_pos = simd::skip_horizontal_space(text, m_pos + 1);
+                continue;
+            }
+            if(c == '\n') {
+                ++m_pos;
+                continue;
+            }
+            if(has_char_class(c, CharClass::NonAscii)) {
+                // A UTF-8 sequence is at most 4 bytes: have all of it loaded.
+                if(short_of(4)) {
+                    refill();
+                    continue;
+                }
+                m_window->m_pos = m_pos;
+                if(!m_window->skip_unicode_whitespace()) { return; }
+                m_pos = m_window->m_pos;
+                continue;
+            }
+            if(c == '/') {
+                if(short_of(2)) {
+                    refill();
+                    continue;
+                }
+                if(const char next = text[m_pos + 1]; next == '/' || next == '*') {
+                    m_pos += 2;
+                    m_comment = next == '/' ? OpenComment::Line : OpenComment::Block;
+                    continue;
+                }
+            }
+            return;
+        }
+    }
+
+    TokenKind StreamingLexer::scan(const bool with_tables) {
+        m_window->m_tables = with_tables ? m_tables : LexTables{};
+        m_window->m_pos = m_pos;
+        return m_window->scan_next();
+    }
+
+    StreamToken StreamingLexer::next() {
+        if(!m_started) {
+            m_started = true;
+            refill();
+            // A short first read may split the BOM: load all three bytes.
+            while(m_end < 3 && !m_eof) { refill(); }
+            if(m_end >= 3 && C_UC(m_buffer[0]) == 0xEFU && C_UC(m_buffer[1]) == 0xBBU && C_UC(m_buffer[2]) == 0xBFU) { m_pos = 3; }
+        }
+        const auto token_reach = m_options.max_token_bytes + Lexer::max_lookahead;
+        while(true) {
+            skip_trivia();
+            if(m_pos == m_end) { return {TokenKind::Eof, m_base + m_end, 0, no_symbol, {}}; }
+
+            // A token that starts this close to the end of the window may be
+            // scanned twice, so its side-table entry waits for the final scan.
+            const bool near_end = !m_eof && m_end - m_pos < token_reach;
+            auto kind = scan(!near_end);
+            if(!m_eof && m_window->m_pos + Lexer::max_lookahead > m_end) {
+                // The token or its lookahead may continue in the next window.
+                if(m_end - m_pos >= token_reach) {
+                    throw std::length_error(
+                        FORMAT("{}: token at offset {} is longer than {} bytes", m_name, m_base + m_pos, m_options.max_token_bytes));
+                }
+                refill();
+                continue;
+            }
+            if(near_end) {
+                m_window->m_tables = m_tables;
+                if(m_window->has_table_for(kind)) { kind = scan(true); }
+            }
+
+            const auto start = m_pos;
+            m_pos = m_window->m_pos;
+            return {kind, m_base + start, C_UI32T(m_pos - start), m_window->m_payload, std::string_view{m_buffer.get() + start, m_pos - start}};
+        }
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
@@ -0,0 +1,38 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/StringTable.hpp"
+
+namespace jsv {
+
+    StringId StringTable::add_string(const std::string_view body, const bool escaped) {
+        m_literals.push_back(decode(body, escaped));
+        return C_UI32T(m_literals.size() - 1);
+    }
+
+    StringId StringTable::add_char(const std::string_view body, const bool escaped) {
+        auto literal = decode(body, escaped);
+        if(!literal.value.empty()) {
+            const auto res = unicode::decode_utf8(literal.value, 0);
+            literal.codepoint = res.status == unicode::Utf8Status::Ok ? res.codepoint : 0;
+            literal.valid = literal.valid && res.status == unicode::Utf8Status::Ok && res.byte_length == literal.value.size();
+        } else {
+            literal.valid = false;
+        }
+        m_literals.push_back(literal);
+        return C_UI32T(m_literals.size() - 1);
+    }
+
+    TextLiteral StringTable::decode(const std::string_view body, const bool escaped) {
+        if(!escaped) { return TextLiteral{.value = body}; }
+        TextLiteral literal;
+        literal.escaped = true;
+        const auto used = detail::unescape(body, m_arena.reserve(body.size()), literal.valid);
+        literal.value = m_arena.commit(used);
+        return literal;
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
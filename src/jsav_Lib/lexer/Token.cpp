@@ -9,6 +9,10 @@ namespace jsv {
 
     std::string Token::to_string() const { return FORMAT(R"({}("{}") {})", tokenKindToString(m_kind), m_text, m_span); }
 
+    std::string Token::to_string(const std::string_view path) const {
+        return FORMAT(R"({}("{}") {})", tokenKindToString(m_kind), m_text, m_span.to_string(path));
+    }
+
     std::ostream &operator<<(std::ostream &os, const Token &token) { return os << token.to_string(); }
 
 }  // namespace jsv
@@ -0,0 +1,70 @@
+/*
+ * Created by gbian on 16/10/2026.
+ * Copyright (c) 2026 All rights reserved.
+ */
+// NOLINTBEGIN(*-include-cleaner, *-identifier-length)
+#include "jsav/lexer/TokenStream.hpp"
+
+namespace jsv {
+
+    void TokenStream::push_back(const TokenKind kind, const std::uint32_t offset, const std::uint32_t length, const std::uint32_t payload) {
+        m_kinds.push_back(kind);
+        m_offsets.push_back(offset);
+        m_lengths.push_back(length);
+        m_payloads.push_back(payload);
+    }
+
+    void TokenStream::append(const TokenStream &other, const std::size_t first) {
+        const auto from = C_PTRDIFT(first);
+        m_kinds.insert(m_kinds.end(), other.m_kinds.begin() + from, other.m_kinds.end());
+        m_offsets.insert(m_offsets.end(), other.m_offsets.begin() + from, other.m_offsets.end());
+        m_lengths.insert(m_lengths.end(), other.m_lengths.begin() + from, other.m_lengths.end());
+        m_payloads.insert(m_payloads.end(), other.m_payloads.begin() + from, other.m_payloads.end());
+    }
+
+    void TokenStream::replace(const std::size_t first, const std::size_t last, const TokenStream &with) {
+        const auto splice = [first, last](auto &target, const auto &source) {
+            const auto common = std::min(last - first, source.size());
+            const auto at = target.begin() + C_PTRDIFT(first);
+            std::ranges::copy_n(source.begin(), C_PTRDIFT(common), at);
+            if(common < source.size()) {
+                target.insert(at + C_PTRDIFT(common), source.begin() + C_PTRDIFT(common), source.end());
+            } else {
+                target.erase(at + C_PTRDIFT(common), target.begin() + C_PTRDIFT(last));
+            }
+        };
+        splice(m_kinds, with.m_kinds);
+        splice(m_offsets, with.m_offsets);
+        splice(m_lengths, with.m_lengths);
+        splice(m_payloads, with.m_payloads);
+    }
+
+    void TokenStream::shift_offsets(const std::size_t first, const std::int64_t delta) noexcept {
+        // Modular u32 arithmetic handles both directions.
+        const auto shift = static_cast<std::uint32_t>(delta);
+        for(auto it = m_offsets.begin() + C_PTRDIFT(first); it != m_offsets.end(); ++it) { *it += shift; }
+    }
+
+    void TokenStream::reserve(const std::size_t count) {
+        m_kinds.reserve(count);
+        m_offsets.reserve(count);
+        m_lengths.reserve(count);
+        m_payloads.reserve(count);
+    }
+
+    void TokenStream::clear() noexcept {
+        m_kinds.clear();
+        m_offsets.clear();
+        m_lengths.clear();
+        m_payloads.clear();
+    }
+
+    void TokenStream::shrink_to_fit() {
+        m_kinds.shrink_to_fit();
+        m_offsets.shrink_to_fit();
+        m_lengths.shrink_to_fit();
+        m_payloads.shrink_to_fit();
+    }
+
+}  // namespace jsv
+// NOLINTEND(*-include-cleaner, *-identifier-length)
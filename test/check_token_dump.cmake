@@ -0,0 +1,35 @@
+# Runs jsav with its token dump on stdout and checks that stdout holds nothing
+# but dump records: every log line, diagnostics included, must go to stderr.
+#
+# Usage: cmake -DJSAV=<jsav executable> -DINPUT=<file or directory> -P check_token_dump.cmake
+
+# JSON lines: each one must be a record.
+execute_process(
+        COMMAND "${JSAV}" -i "${INPUT}" --emit-tokens jsonl
+        OUTPUT_VARIABLE dump
+        ERROR_VARIABLE log)
+if (dump STREQUAL "")
+    message(FATAL_ERROR "No jsonl token dump on stdout")
+endif ()
+if (log STREQUAL "")
+    message(FATAL_ERROR "No log on stderr")
+endif ()
+string(REGEX REPLACE "{\"file\":\"[^\n]*}\n" "" stray "${dump}")
+if (NOT stray STREQUAL "")
+    message(FATAL_ERROR "stdout holds more than jsonl records:\n${stray}")
+endif ()
+
+# Binary: the magic comes first, and no log text follows anywhere.
+execute_process(
+        COMMAND "${JSAV}" -i "${INPUT}" --emit-tokens binary
+        OUTPUT_FILE dump.bin
+        ERROR_VARIABLE log)
+file(READ dump.bin magic LIMIT 8)
+if (NOT magic STREQUAL "JSVTOK1\n")
+    message(FATAL_ERROR "Binary token dump does not start with its magic: ${magic}")
+endif ()
+file(STRINGS dump.bin stray REGEX "\\[[0-9:]+ (info|error)\\]")
+if (stray)
+    message(FATAL_ERROR "Binary token dump holds log lines:\n${stray}")
+endif ()
+file(REMOVE dump.bin)
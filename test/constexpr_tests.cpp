@@ -605,6 +605,267 @@ TEST_CASE("Lexer_IsAsciiHorizontalSpace_OtherPunctuationReturnsFalse", "[Lexer]"
     STATIC_REQUIRE(!is_ascii_horizontal_space(';'));
 }
 
+// ==========================================================================
+// Bulk UTF-8 validation (is_valid_utf8)
+// ==========================================================================
+
+TEST_CASE("Utf8Validator_WholeRun_MatchesPerSequenceDecode", "[Unicode][validate]") {
+    using namespace jsv::unicode;
+    STATIC_REQUIRE(is_valid_utf8(""));
+    STATIC_REQUIRE(is_valid_utf8("plain ascii text, longer than one word"));
+    STATIC_REQUIRE(is_valid_utf8("\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80 mixed \xD0\xB1"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("\x80"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("abcdefgh\xC0\xAF"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("\xED\xA0\x80"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("\xF4\x90\x80\x80"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("trunc\xE4\xB8"));
+    STATIC_REQUIRE_FALSE(is_valid_utf8("\xFF"));
+}
+
+TEST_CASE("Interner_SymbolHash_FoldsBytesIncrementally", "[Lexer][interner]") {
+    using namespace jsv::detail;
+    STATIC_REQUIRE(symbol_hash("") == symbol_hash_seed);
+    STATIC_REQUIRE(symbol_hash("ab") == symbol_hash_step(symbol_hash_step(symbol_hash_seed, 'a'), 'b'));
+    STATIC_REQUIRE(symbol_hash("ab") != symbol_hash("ba"));
+    STATIC_REQUIRE(symbol_hash("a") == 0xAF63DC4C8601EC8CULL);  // FNV-1a reference value
+}
+
+TEST_CASE("NumericLiteral_Helpers_DecodeAtCompileTime", "[Lexer][literals]") {
+    using namespace jsv::detail;
+    STATIC_REQUIRE(jsv::hex_digit_value('7') == 7);
+    STATIC_REQUIRE(jsv::hex_digit_value('a') == 10);
+    STATIC_REQUIRE(jsv::hex_digit_value('F') == 15);
+    STATIC_REQUIRE([] {
+        bool overflow = false;
+        const auto max = accumulate_digit(1844674407370955161ULL, 10, 5, overflow);
+        return max == std::numeric_limits<std::uint64_t>::max() && !overflow;
+    }());
+    STATIC_REQUIRE([] {
+        bool overflow = false;
+        return accumulate_digit(1844674407370955161ULL, 10, 6, overflow) == 1844674407370955161ULL && overflow;
+    }());
+    STATIC_REQUIRE([] {
+        double value = 0;
+        return decimal_to_double_fast(314, -4, value) && value == 0.0314;
+    }());
+    STATIC_REQUIRE([] {
+        double value = 0;
+        return !decimal_to_double_fast(1, 23, value) && !decimal_to_double_fast((1ULL << 53U) + 1, 0, value);
+    }());
+}
+
+TEST_CASE("CompactToken_Payload_IsSymbolOrLiteralByKind", "[Lexer][literals]") {
+    constexpr jsv::CompactToken number{jsv::TokenKind::Hexadecimal, 0, 4, 0, 7};
+    STATIC_REQUIRE(number.getLiteral() == 7);
+    STATIC_REQUIRE(number.getSymbol() == jsv::no_symbol);
+    constexpr jsv::CompactToken name{jsv::TokenKind::IdentifierAscii, 0, 4, 0, 7};
+    STATIC_REQUIRE(name.getSymbol() == 7);
+    STATIC_REQUIRE(name.getLiteral() == jsv::no_literal);
+    STATIC_REQUIRE(name.getPayload() == number.getPayload());
+}
+
+namespace {
+    // Decode `body` and compare with `expected`, at compile time.
+    constexpr bool unescapes_to(const std::string_view body, const std::string_view expected, const bool expected_valid) {
+        std::array<char, 32> out{};
+        bool valid = true;
+        const auto size = jsv::detail::unescape(body, out.data(), valid);
+        return std::string_view{out.data(), size} == expected && valid == expected_valid;
+    }
+}  // namespace
+
+TEST_CASE("StringTable_Unescape_DecodesAtCompileTime", "[Lexer][strings]") {
+    STATIC_REQUIRE(unescapes_to("plain", "plain", true));
+    STATIC_REQUIRE(unescapes_to(R"(a\tb\n\0\\\"\')", std::string_view{"a\tb\n\0\\\"'", 8}, true));
+    STATIC_REQUIRE(unescapes_to(R"(\u00e9\U0001F600)", "\xC3\xA9\xF0\x9F\x98\x80", true));
+    STATIC_REQUIRE(unescapes_to(R"(\q)", R"(\q)", false));
+    STATIC_REQUIRE(unescapes_to(R"(\u12)", R"(\u12)", false));
+    STATIC_REQUIRE(unescapes_to(R"(\uD800)", R"(\uD800)", false));
+    STATIC_REQUIRE(unescapes_to("tail\\", "tail\\", false));
+}
+
+TEST_CASE("Utf8_EncodeUtf8_RoundTripsAtCompileTime", "[Unicode][Utf8]") {
+    STATIC_REQUIRE([] {
+        for(const char32_t cp : {U'a', U'\u00e9', U'\u20ac', U'\U0001F600', U'\U0010FFFF', U'\u007F', U'\u0080', U'\u07FF', U'\u0800'}) {
+            std::array<char, 4> out{};
+            const auto size = jsv::unicode::encode_utf8(cp, out.data());
+            const auto res = jsv::unicode::decode_utf8(std::string_view{out.data(), size}, 0);
+            if(res.status != jsv::unicode::Utf8Status::Ok || res.codepoint != cp || res.byte_length != size) { return false; }
+        }
+        return true;
+    }());
+}
+
+TEST_CASE("Operators_Trie_ResolvesEverySpellingAtCompileTime", "[Lexer][operators]") {
+    STATIC_REQUIRE([] {
+        for(const auto &entry : jsv::operator_list) {
+            const auto match = jsv::match_operator(entry.text[0], entry.text.size() == 2 ? entry.text[1] : '\0');
+            if(match.kind != entry.kind || match.length != entry.text.size()) { return false; }
+        }
+        return true;
+    }());
+    STATIC_REQUIRE(jsv::match_operator('<', '<').kind == jsv::TokenKind::ShiftLeft);
+    STATIC_REQUIRE(jsv::match_operator('<', 'a').kind == jsv::TokenKind::Less);
+    STATIC_REQUIRE(jsv::match_operator('*', '=').length == 1);
+    STATIC_REQUIRE(jsv::match_operator('@', '=').length == 0);
+    STATIC_REQUIRE(jsv::match_operator('#', 'x').length == 0);
+}
+
+TEST_CASE("CharClass_TokenStartTable_DispatchesFirstBytes", "[Lexer][operators]") {
+    using enum jsv::TokenStart;
+    STATIC_REQUIRE(jsv::token_start_table['7'] == Digit);
+    STATIC_REQUIRE(jsv::token_start_table['.'] == Dot);
+    STATIC_REQUIRE(jsv::token_start_table['#'] == Hash);
+    STATIC_REQUIRE(jsv::token_start_table['"'] == String);
+    STATIC_REQUIRE(jsv::token_start_table['\''] == Char);
+    STATIC_REQUIRE(jsv::token_start_table['_'] == Identifier);
+    STATIC_REQUIRE(jsv::token_start_table['Z'] == Identifier);
+    STATIC_REQUIRE(jsv::token_start_table[0xE5] == NonAscii);
+    STATIC_REQUIRE(jsv::token_start_table['{'] == Operator);
+    STATIC_REQUIRE(jsv::token_start_table['@'] == Other);
+    STATIC_REQUIRE(jsv::token_start_table['\0'] == Other);
+}
+
+TEST_CASE("UnicodeData_PropertyTables_MatchRangesAtCompileTime", "[Unicode][tables]") {
+    using namespace jsv::unicode;
+    STATIC_REQUIRE(id_start_table.contains(U'中') == detail::in_ranges(U'中', id_start_ranges));
+    STATIC_REQUIRE(id_continue_table.contains(char32_t{0x0303U}));
+    STATIC_REQUIRE(letter_table.contains(char32_t{0x2B73FU}) == detail::in_ranges(char32_t{0x2B73FU}, letter_ranges));
+    STATIC_REQUIRE(whitespace_table.contains(char32_t{0x3000U}));
+    STATIC_REQUIRE_FALSE(id_continue_table.contains(char32_t{0x10FFFFU}));
+    STATIC_REQUIRE_FALSE(letter_table.contains(char32_t{0x110000U}));
+}
+
+TEST_CASE("Utf8Validator_WholeBuffer_RecordsInvalidRangesAtCompileTime", "[Unicode][validate]") {
+    using namespace jsv::unicode;
+    STATIC_REQUIRE(detail::validate_utf8_scalar("a\xC3\xA9 \xE4\xB8\xAD b").is_valid());
+    STATIC_REQUIRE(detail::validate_utf8_scalar("a\x80\x80 b\xFF").invalid.size() == 2);
+    STATIC_REQUIRE(detail::validate_utf8_scalar("a\x80\x80 b\xFF").invalid[0] == Utf8Range{1, 3});
+    STATIC_REQUIRE(detail::validate_utf8_scalar("a\x80\x80 b\xFF").invalid[1] == Utf8Range{5, 6});
+    STATIC_REQUIRE(detail::validate_utf8_scalar("trunc\xE4\xB8").invalid[0] == Utf8Range{5, 7});
+    STATIC_REQUIRE(Utf8Validation{{{4, 6}}}.is_valid_range(0, 4));
+    STATIC_REQUIRE_FALSE(Utf8Validation{{{4, 6}}}.is_valid_range(5, 6));
+    STATIC_REQUIRE_FALSE(Utf8Validation{{{4, 6}}}.is_valid_range(2, 9));
+    STATIC_REQUIRE(Utf8Validation{{{4, 6}}}.is_valid_range(6, 9));
+    STATIC_REQUIRE(decode_utf8_unchecked("\xF0\x9F\x98\x80", 0).codepoint == U'\U0001F600');
+    STATIC_REQUIRE(decode_utf8_unchecked("x\xE4\xB8\xAD", 1).codepoint == U'中');
+    STATIC_REQUIRE(decode_utf8_unchecked("\xC3\xA9", 0).byte_length == 2);
+}
+
+// ==========================================================================
+// Lexer: char_class_table constexpr tests
+// ==========================================================================
+
+TEST_CASE("CharClass_Table_ClassifiesAsciiAtCompileTime", "[Lexer][CharClass]") {
+    using namespace jsv;
+    STATIC_REQUIRE(is_ascii_digit('0'));
+    STATIC_REQUIRE(is_ascii_digit('9'));
+    STATIC_REQUIRE(!is_ascii_digit('a'));
+    STATIC_REQUIRE(is_ascii_hex_digit('F'));
+    STATIC_REQUIRE(is_ascii_hex_digit('a'));
+    STATIC_REQUIRE(!is_ascii_hex_digit('g'));
+    STATIC_REQUIRE(is_ascii_ident_start('_'));
+    STATIC_REQUIRE(is_ascii_ident_start('Z'));
+    STATIC_REQUIRE(!is_ascii_ident_start('1'));
+    STATIC_REQUIRE(is_ascii_ident_continue('1'));
+    STATIC_REQUIRE(!is_ascii_alnum('_'));
+    STATIC_REQUIRE(has_char_class('{', CharClass::OperatorStart));
+    STATIC_REQUIRE(has_char_class(';', CharClass::OperatorStart));
+    STATIC_REQUIRE(!has_char_class('#', CharClass::OperatorStart));
+    STATIC_REQUIRE(has_char_class('\x80', CharClass::NonAscii));
+    STATIC_REQUIRE(has_char_class('\xff', CharClass::NonAscii));
+    STATIC_REQUIRE(!has_char_class('\x7f', CharClass::NonAscii));
+    STATIC_REQUIRE(!has_char_class('\xe9', CharClass::Alpha | CharClass::Digit));
+}
+
+// ==========================================================================
+// Lexer: perfect-hash keyword recognizer
+// ==========================================================================
+
+TEST_CASE("Keywords_PerfectHash_ClassifiesAtCompileTime", "[Lexer][keyword]") {
+    using namespace jsv;
+    STATIC_REQUIRE(classify_keyword("while") == TokenKind::KeywordWhile);
+    STATIC_REQUIRE(classify_keyword("nullptr") == TokenKind::KeywordNullptr);
+    STATIC_REQUIRE(classify_keyword("i8") == TokenKind::TypeI8);
+    STATIC_REQUIRE(classify_keyword("u64") == TokenKind::TypeU64);
+    STATIC_REQUIRE(classify_keyword("string") == TokenKind::TypeString);
+    // Same length, first and last byte as a keyword, different middle.
+    STATIC_REQUIRE(classify_keyword("wxyze") == TokenKind::IdentifierAscii);
+    STATIC_REQUIRE(classify_keyword("fan") == TokenKind::IdentifierAscii);
+    STATIC_REQUIRE(classify_keyword("i") == TokenKind::IdentifierAscii);
+    STATIC_REQUIRE(classify_keyword("") == TokenKind::IdentifierAscii);
+    STATIC_REQUIRE(classify_keyword("While") == TokenKind::IdentifierAscii);
+}
+
+// ==========================================================================
+// Lexer: CompactToken layout
+// ==========================================================================
+
+TEST_CASE("CompactToken_Layout_FitsInSixteenBytes", "[Lexer][compact]") {
+    using namespace jsv;
+    STATIC_REQUIRE(sizeof(CompactToken) <= 16);
+    STATIC_REQUIRE(std::is_trivially_copyable_v<CompactToken>);
+    constexpr CompactToken token{TokenKind::Numeric, 40, 3, 2};
+    STATIC_REQUIRE(token.getKind() == TokenKind::Numeric);
+    STATIC_REQUIRE(token.getOffset() == 40);
+    STATIC_REQUIRE(token.getEndOffset() == 43);
+    STATIC_REQUIRE(token.getFileId() == 2);
+    STATIC_REQUIRE(CompactToken{}.getKind() == TokenKind::Eof);
+    STATIC_REQUIRE(detail::line_terminator_length("\n", 0) == 1);
+    STATIC_REQUIRE(detail::line_terminator_length("\xC2\x85", 0) == 2);
+    STATIC_REQUIRE(detail::line_terminator_length("\xE2\x80\xA9", 0) == 3);
+    STATIC_REQUIRE(detail::line_terminator_length("\xE2\x80\xA0", 0) == 0);
+    STATIC_REQUIRE(detail::line_terminator_length("\xC2", 0) == 0);
+}
+
+TEST_CASE("LineIndex_IsLineBreakLead_ClassifiesAtCompileTime", "[Lexer][lines]") {
+    using namespace jsv::simd::detail;
+    STATIC_REQUIRE(is_line_break_lead('\n'));
+    STATIC_REQUIRE(is_line_break_lead('\xC2'));
+    STATIC_REQUIRE(is_line_break_lead('\xE2'));
+    STATIC_REQUIRE(!is_line_break_lead('\r'));
+    STATIC_REQUIRE(!is_line_break_lead('\xE4'));
+    STATIC_REQUIRE(find_line_break_candidate_scalar("abc\xC2\x85", 0) == 3);
+    STATIC_REQUIRE(find_line_break_candidate_scalar("abc", 1) == 3);
+}
+
+TEST_CASE("TokenStream_Iterator_ModelsRandomAccessRange", "[Lexer][tokenstream]") {
+    using namespace jsv;
+    STATIC_REQUIRE(std::ranges::random_access_range<TokenStream>);
+    STATIC_REQUIRE(std::ranges::sized_range<TokenStream>);
+    STATIC_REQUIRE(std::same_as<std::ranges::range_value_t<TokenStream>, CompactToken>);
+    STATIC_REQUIRE(std::random_access_iterator<TokenStream::const_iterator>);
+}
+
+TEST_CASE("Lexer_TokensRange_ModelsInputView", "[Lexer][range]") {
+    using namespace jsv;
+    STATIC_REQUIRE(std::ranges::input_range<TokenRange>);
+    STATIC_REQUIRE(std::ranges::view<TokenRange>);
+    STATIC_REQUIRE(std::same_as<std::ranges::range_reference_t<TokenRange>, const Token &>);
+    STATIC_REQUIRE(std::ranges::viewable_range<TokenRange>);
+}
+
+TEST_CASE("GlobMatch_MatchesAtCompileTime", "[driver][inputs]") {
+    using jsv::glob_match;
+    STATIC_REQUIRE(glob_match("*.vn", "main.vn"));
+    STATIC_REQUIRE(glob_match("*.vn", ".vn"));
+    STATIC_REQUIRE(!glob_match("*.vn", "main.vnx"));
+    STATIC_REQUIRE(glob_match("a*b*c", "a_b_b_c"));
+    STATIC_REQUIRE(!glob_match("a*b*c", "a_b_b_"));
+    STATIC_REQUIRE(glob_match("?.vn", "a.vn"));
+    STATIC_REQUIRE(!glob_match("?.vn", "ab.vn"));
+    STATIC_REQUIRE(glob_match("[abc].vn", "b.vn"));
+    STATIC_REQUIRE(glob_match("[a-c]x", "cx"));
+    STATIC_REQUIRE(!glob_match("[a-c]x", "dx"));
+    STATIC_REQUIRE(glob_match("[!a]x", "bx"));
+    STATIC_REQUIRE(!glob_match("[!a]x", "ax"));
+    STATIC_REQUIRE(glob_match("[x", "[x"));
+    STATIC_REQUIRE(glob_match("**", ""));
+    STATIC_REQUIRE(!glob_match("a", ""));
+    STATIC_REQUIRE(jsv::is_glob_char('*'));
+    STATIC_REQUIRE(!jsv::is_glob_char('.'));
+}
+
 // clang-format off
 // NOLINTEND(*-include-cleaner, *-avoid-magic-numbers, *-magic-numbers, *-unchecked-optional-access, *-avoid-do-while, *-use-anonymous-namespace, *-qualified-auto, *-suspicious-stringview-data-usage, *-err58-cpp, *-function-cognitive-complexity, *-macro-usage, *-unnecessary-copy-initialization)
 // clang-format on
\ No newline at end of file
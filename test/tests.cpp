@@ -9,8 +9,15 @@
 #include <catch2/matchers/catch_matchers_container_properties.hpp>
 #include <catch2/matchers/catch_matchers_exception.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
+#include <charconv>
 #include <future>
+#include <jsav/lexer/unicode/UnicodeData.hpp>
 #include <set>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using Catch::Matchers::ContainsSubstring;
 using Catch::Matchers::EndsWith;
@@ -799,6 +806,175 @@ TEST_CASE("vnd::readFromFile - Large File", "[file]") {
     [[maybe_unused]] auto unsed = fs::remove(lrgfilename);
 }
 
+namespace {
+    [[nodiscard]] bool padding_is_zero(const vnd::SourceBuffer &buffer) {
+        const std::string_view tail{buffer.data() + buffer.size(), vnd::SourceBuffer::padding};
+        return tail.find_first_not_of('\0') == std::string_view::npos;
+    }
+}  // namespace
+
+TEST_CASE("vnd::SourceBuffer - Small file is read into a padded buffer", "[file]") {
+    const std::string infilename = "sourcebuffer_small.txt";
+    const std::string content = "This is a test.";
+    createFile(infilename, content);
+
+    const auto buffer = vnd::SourceBuffer::from_file(infilename);
+    REQUIRE(buffer.text() == content);
+    REQUIRE_FALSE(buffer.is_mapped());
+    REQUIRE(padding_is_zero(buffer));
+
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+
+TEST_CASE("vnd::SourceBuffer - Large file is mapped with zero padding", "[file]") {
+    const std::string lrgfilename = "sourcebuffer_large.txt";
+    // One size ending on a page boundary (no slack left in the last page)
+    // and one leaving fewer than `padding` bytes of slack.
+    const auto size = GENERATE(std::size_t{256} * 1024, std::size_t{256} * 1024 - 10);
+    std::string largeContent(size, 'a');
+    largeContent.back() = 'z';
+    createFile(lrgfilename, largeContent);
+
+    const auto buffer = vnd::SourceBuffer::from_file(lrgfilename);
+    REQUIRE(buffer.is_mapped());
+    REQUIRE(buffer.size() == size);
+    REQUIRE(buffer.text() == largeContent);
+    REQUIRE(padding_is_zero(buffer));
+
+    [[maybe_unused]] auto unsed = fs::remove(lrgfilename);
+}
+
+TEST_CASE("vnd::SourceBuffer - Empty file", "[file]") {
+    const std::string emtfilename = "sourcebuffer_empty.txt";
+    createFile(emtfilename, "");
+
+    const auto buffer = vnd::SourceBuffer::from_file(emtfilename);
+    REQUIRE(buffer.empty());
+    REQUIRE(padding_is_zero(buffer));
+
+    [[maybe_unused]] auto unsed = fs::remove(emtfilename);
+}
+
+TEST_CASE("vnd::SourceBuffer - Missing files and directories are rejected", "[file]") {
+    const std::string nonExistentFile = "nonexistent.txt";
+    REQUIRE_THROWS_MATCHES(vnd::SourceBuffer::from_file(nonExistentFile), std::runtime_error,
+                           MSG_FORMAT("File not found: {}", nonExistentFile));
+
+    const std::string dirName = "sourcebuffer_dir";
+    fs::create_directory(dirName);
+    REQUIRE_THROWS_MATCHES(vnd::SourceBuffer::from_file(dirName), std::runtime_error, MSG_FORMAT("Path is not a regular file: {}", dirName));
+    [[maybe_unused]] auto unsed = fs::remove(dirName);
+}
+
+#ifndef _WIN32
+TEST_CASE("vnd::SourceBuffer - Pipe is read until EOF", "[file]") {
+    const std::string fifoname = "sourcebuffer_fifo";
+    [[maybe_unused]] auto stale = fs::remove(fifoname);
+    REQUIRE(::mkfifo(fifoname.c_str(), 0600) == 0);
+    // Larger than the initial read buffer, so it has to grow.
+    std::string content(std::size_t{200} * 1024, 'p');
+    content.front() = 'f';
+    auto writer = std::async(std::launch::async, [&] { createFile(fifoname, content); });
+
+    const auto buffer = vnd::SourceBuffer::from_file(fifoname);
+    writer.get();
+    REQUIRE_FALSE(buffer.is_mapped());
+    REQUIRE(buffer.text() == content);
+    REQUIRE(padding_is_zero(buffer));
+
+    [[maybe_unused]] auto unsed = fs::remove(fifoname);
+}
+#endif
+
+TEST_CASE("vnd::SourceBuffer - copy_of and moves keep the padding", "[file]") {
+    auto buffer = vnd::SourceBuffer::copy_of("var x = 1;");
+    REQUIRE(buffer.text() == "var x = 1;");
+    REQUIRE(padding_is_zero(buffer));
+
+    auto moved = vnd_move(buffer);
+    REQUIRE(moved.text() == "var x = 1;");
+    REQUIRE(buffer.empty());  // NOLINT(*-use-after-move, *-invalid-access-moved)
+    REQUIRE(padding_is_zero(buffer));
+}
+
+TEST_CASE("vnd::SourceBuffer - try_from_file reports errors as values", "[file]") {
+    const std::string nonExistentFile = "nonexistent.txt";
+    const auto missing = vnd::SourceBuffer::try_from_file(nonExistentFile);
+    REQUIRE_FALSE(missing.has_value());
+    REQUIRE(std::string_view{missing.error().what()} == FORMAT("File not found: {}", nonExistentFile));
+
+    const std::string infilename = "sourcebuffer_try.vn";
+    createFile(infilename, "var x = 1;");
+    const auto loaded = vnd::SourceBuffer::try_from_file(infilename);
+    REQUIRE(loaded.has_value());
+    REQUIRE(loaded->text() == "var x = 1;");
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+
+TEST_CASE("vnd::SourceBuffer - from_files loads a batch concurrently", "[file]") {
+    const fs::path dir = "sourcebuffer_batch";
+    fs::create_directories(dir);
+    std::vector<std::string> paths;
+    for(int i = 0; i < 64; ++i) {
+        paths.push_back((dir / FORMAT("f{}.vn", i)).string());
+        // Every 8th file is large enough to be mapped.
+        createFile(paths.back(), i % 8 == 0 ? std::string(std::size_t{70} * 1024, 'a') + FORMAT("{}", i) : FORMAT("var v{} = {};", i, i));
+    }
+    paths.push_back((dir / "missing.vn").string());
+    paths.push_back(dir.string());
+
+    for(const std::size_t threads : {std::size_t{1}, std::size_t{4}, std::size_t{0}}) {
+        const auto results = vnd::SourceBuffer::from_files(paths, threads);
+        REQUIRE(results.size() == paths.size());
+        for(std::size_t i = 0; i < 64; ++i) {
+            REQUIRE(results[i].has_value());
+            REQUIRE(results[i]->text() == vnd::readFromFile(paths[i]));
+            REQUIRE(padding_is_zero(*results[i]));
+        }
+        REQUIRE(std::string_view{results[64].error().what()} == FORMAT("File not found: {}", paths[64]));
+        REQUIRE(std::string_view{results[65].error().what()} == FORMAT("Path is not a regular file: {}", paths[65]));
+    }
+    REQUIRE(vnd::SourceBuffer::from_files({}).empty());
+
+    [[maybe_unused]] auto unsed = fs::remove_all(dir);
+}
+
+TEST_CASE("vnd::readFromFile - Concurrent reads", "[file]") {
+    const std::string infilename = "concurrent_read.txt";
+    const std::string content(std::size_t{256} * 1024, 'c');
+    createFile(infilename, content);
+
+    std::vector<std::future<bool>> readers;
+    for(int i = 0; i < 8; ++i) {
+        readers.push_back(std::async(std::launch::async, [&] { return vnd::readFromFile(infilename) == content; }));
+    }
+    for(auto &reader : readers) { REQUIRE(reader.get()); }
+
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+
+TEST_CASE("Lexer_SourceBuffer_LexesInPlace", "[lexer]") {
+    const std::string lexfilename = "sourcebuffer_lex.vn";
+    std::string source;
+    for(int i = 0; i < 4000; ++i) { source += FORMAT("var v{} = {} + \"s\"; // c\n", i, i); }
+    createFile(lexfilename, source);
+
+    const auto buffer = vnd::SourceBuffer::from_file(lexfilename);
+    REQUIRE(buffer.is_mapped());
+    jsv::Lexer fromBuffer{buffer, lexfilename};
+    jsv::Lexer fromString{std::string_view{source}, lexfilename};
+    const auto expected = fromString.tokenize();
+    const auto tokens = fromBuffer.tokenize();
+    REQUIRE(tokens.size() == expected.size());
+    for(std::size_t i = 0; i < tokens.size(); ++i) {
+        REQUIRE(tokens[i].getKind() == expected[i].getKind());
+        REQUIRE(tokens[i].getText() == expected[i].getText());
+        REQUIRE(tokens[i].getText().data() >= buffer.data());
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove(lexfilename);
+}
+
 TEST_CASE("GetBuildFolder - Standard Cases") {
     SECTION("Normal path without trailing slash") {
         const fs::path inputPath = fs::path("home/user/project").make_preferred();
@@ -1346,10 +1522,16 @@ TEST_CASE("SourceLocation member field mutability", "[SourceLocation]") {
 // SourceSpan Tests (Non-constexpr)
 // ============================================================================
 
+namespace {
+    // Ids of the files the spans below point into; 0 is a default span's.
+    constexpr jsv::FileId test_file_id = 1;
+    constexpr jsv::FileId main_file_id = 2;
+}  // namespace
+
 TEST_CASE("SourceSpan default constructor initializes correctly", "[SourceSpan]") {
     const jsv::SourceSpan span;
 
-    REQUIRE(span.file_path.empty());
+    REQUIRE(span.file_id == 0);
     REQUIRE(span.start.line == 0u);
     REQUIRE(span.start.column == 0u);
     REQUIRE(span.start.absolute_pos == 0u);
@@ -1363,9 +1545,9 @@ TEST_CASE("SourceSpan parameterized constructor initializes correctly", "[Source
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(5u, 10u, 250u);
 
-        const jsv::SourceSpan span("test/file.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
-        REQUIRE(span.file_path == "test/file.cpp");
+        REQUIRE(span.file_id == test_file_id);
         REQUIRE(span.start.line == 1u);
         REQUIRE(span.start.column == 1u);
         REQUIRE(span.start.absolute_pos == 0u);
@@ -1377,21 +1559,22 @@ TEST_CASE("SourceSpan parameterized constructor initializes correctly", "[Source
     SECTION("empty span at same position") {
         const jsv::SourceLocation pos(3u, 5u, 20u);
 
-        const jsv::SourceSpan span("empty.cpp", pos, pos);
+        const jsv::SourceSpan span(main_file_id, pos, pos);
 
-        REQUIRE(span.file_path == "empty.cpp");
+        REQUIRE(span.file_id == main_file_id);
         REQUIRE(span.start.line == 3u);
         REQUIRE(span.end.line == 3u);
         REQUIRE(span.start == span.end);
     }
 
-    SECTION("deep path") {
+    SECTION("largest file id") {
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(1u, 1u, 10u);
+        constexpr auto last = std::numeric_limits<jsv::FileId>::max();
 
-        const jsv::SourceSpan span("a/b/c/d/e/file.cpp", start, end);
+        const jsv::SourceSpan span(last, start, end);
 
-        REQUIRE(span.file_path == "a/b/c/d/e/file.cpp");
+        REQUIRE(span.file_id == last);
     }
 }
 
@@ -1399,11 +1582,11 @@ TEST_CASE("SourceSpan merge mutates in-place correctly", "[SourceSpan]") {
     SECTION("merge overlapping spans from same file") {
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation end1(2u, 5u, 50u);
-        jsv::SourceSpan span1("test.cpp", start1, end1);
+        jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(2u, 1u, 30u);
         const jsv::SourceLocation end2(3u, 10u, 100u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         span1.merge(span2);
 
@@ -1416,11 +1599,11 @@ TEST_CASE("SourceSpan merge mutates in-place correctly", "[SourceSpan]") {
     SECTION("merge with earlier start extends backward") {
         const jsv::SourceLocation start1(5u, 10u, 100u);
         const jsv::SourceLocation end1(10u, 5u, 500u);
-        jsv::SourceSpan span1("test.cpp", start1, end1);
+        jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(2u, 3u, 20u);
         const jsv::SourceLocation end2(6u, 1u, 200u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         span1.merge(span2);
 
@@ -1431,11 +1614,11 @@ TEST_CASE("SourceSpan merge mutates in-place correctly", "[SourceSpan]") {
     SECTION("merge with later end extends forward") {
         const jsv::SourceLocation start1(5u, 10u, 100u);
         const jsv::SourceLocation end1(10u, 5u, 500u);
-        jsv::SourceSpan span1("test.cpp", start1, end1);
+        jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(6u, 1u, 200u);
         const jsv::SourceLocation end2(15u, 10u, 1000u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         span1.merge(span2);
 
@@ -1444,15 +1627,15 @@ TEST_CASE("SourceSpan merge mutates in-place correctly", "[SourceSpan]") {
     }
 
     SECTION("merge from different file does nothing") {
-        const auto filePath1 = std::string_view{"file1.cpp"};
-        const auto filePath2 = std::string_view{"file2.cpp"};
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation end1(5u, 5u, 100u);
-        jsv::SourceSpan span1(filePath1, start1, end1);
+        jsv::SourceSpan span1(fileId1, start1, end1);
 
         const jsv::SourceLocation start2(2u, 2u, 50u);
         const jsv::SourceLocation end2(10u, 10u, 500u);
-        const jsv::SourceSpan span2(filePath2, start2, end2);
+        const jsv::SourceSpan span2(fileId2, start2, end2);
 
         const jsv::SourceLocation originalStart = span1.start;
         const jsv::SourceLocation originalEnd = span1.end;
@@ -1467,8 +1650,8 @@ TEST_CASE("SourceSpan merge mutates in-place correctly", "[SourceSpan]") {
     SECTION("merge identical spans") {
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(5u, 5u, 100u);
-        jsv::SourceSpan span1("test.cpp", start, end);
-        const jsv::SourceSpan span2("test.cpp", start, end);
+        jsv::SourceSpan span1(test_file_id, start, end);
+        const jsv::SourceSpan span2(test_file_id, start, end);
 
         span1.merge(span2);
 
@@ -1481,30 +1664,30 @@ TEST_CASE("SourceSpan merged returns optional correctly", "[SourceSpan]") {
     SECTION("merge spans from same file returns value") {
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation end1(2u, 5u, 50u);
-        const jsv::SourceSpan span1("test.cpp", start1, end1);
+        const jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(2u, 1u, 30u);
         const jsv::SourceLocation end2(3u, 10u, 100u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         const std::optional<jsv::SourceSpan> result = span1.merged(span2);
 
         REQUIRE(result.has_value());
         REQUIRE(result->start.line == 1u);  // earlier start
         REQUIRE(result->end.line == 3u);    // later end
-        REQUIRE(result->file_path == "test.cpp");
+        REQUIRE(result->file_id == test_file_id);
     }
 
     SECTION("merge spans from different files returns nullopt") {
-        const auto filePath1 = std::string_view{"file1.cpp"};
-        const auto filePath2 = std::string_view{"file2.cpp"};
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation end1(5u, 5u, 100u);
-        const jsv::SourceSpan span1(filePath1, start1, end1);
+        const jsv::SourceSpan span1(fileId1, start1, end1);
 
         const jsv::SourceLocation start2(2u, 2u, 50u);
         const jsv::SourceLocation end2(10u, 10u, 500u);
-        const jsv::SourceSpan span2(filePath2, start2, end2);
+        const jsv::SourceSpan span2(fileId2, start2, end2);
 
         const std::optional<jsv::SourceSpan> result = span1.merged(span2);
 
@@ -1514,11 +1697,11 @@ TEST_CASE("SourceSpan merged returns optional correctly", "[SourceSpan]") {
     SECTION("merged does not mutate original spans") {
         const jsv::SourceLocation start1(5u, 5u, 100u);
         const jsv::SourceLocation end1(10u, 10u, 500u);
-        jsv::SourceSpan span1("test.cpp", start1, end1);
+        jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(1u, 1u, 0u);
         const jsv::SourceLocation end2(15u, 15u, 1000u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         const std::optional<jsv::SourceSpan> result = span1.merged(span2);
 
@@ -1537,13 +1720,13 @@ TEST_CASE("SourceSpan merged returns optional correctly", "[SourceSpan]") {
     SECTION("merge with empty span") {
         const jsv::SourceLocation start1(5u, 5u, 100u);
         const jsv::SourceLocation end1(10u, 10u, 500u);
-        const jsv::SourceSpan span1("test.cpp", start1, end1);
+        const jsv::SourceSpan span1(test_file_id, start1, end1);
 
-        const jsv::SourceSpan span2;  // default constructed (empty file path)
+        const jsv::SourceSpan span2;  // default constructed (file 0)
 
         const std::optional<jsv::SourceSpan> result = span1.merged(span2);
 
-        // Different file paths (one empty)
+        // Different file ids (one default)
         REQUIRE_FALSE(result.has_value());
     }
 }
@@ -1552,8 +1735,8 @@ TEST_CASE("SourceSpan spaceship operator provides correct ordering", "[SourceSpa
     SECTION("equal spans") {
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(5u, 5u, 100u);
-        const jsv::SourceSpan span1("test.cpp", start, end);
-        const jsv::SourceSpan span2("test.cpp", start, end);
+        const jsv::SourceSpan span1(test_file_id, start, end);
+        const jsv::SourceSpan span2(test_file_id, start, end);
 
         REQUIRE(span1 == span2);
         REQUIRE_FALSE(span1 != span2);
@@ -1564,12 +1747,12 @@ TEST_CASE("SourceSpan spaceship operator provides correct ordering", "[SourceSpa
     }
 
     SECTION("different file paths") {
-        const auto filePath1 = std::string_view{"a.cpp"};
-        const auto filePath2 = std::string_view{"b.cpp"};
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
         const jsv::SourceLocation start;
         const jsv::SourceLocation end(1u, 1u, 10u);
-        const jsv::SourceSpan span1(filePath1, start, end);
-        const jsv::SourceSpan span2(filePath2, start, end);
+        const jsv::SourceSpan span1(fileId1, start, end);
+        const jsv::SourceSpan span2(fileId2, start, end);
 
         REQUIRE(span1 < span2);
         REQUIRE(span2 > span1);
@@ -1580,8 +1763,8 @@ TEST_CASE("SourceSpan spaceship operator provides correct ordering", "[SourceSpa
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation start2(3u, 1u, 50u);
         const jsv::SourceLocation end(5u, 5u, 100u);
-        const jsv::SourceSpan span1("test.cpp", start1, end);
-        const jsv::SourceSpan span2("test.cpp", start2, end);
+        const jsv::SourceSpan span1(test_file_id, start1, end);
+        const jsv::SourceSpan span2(test_file_id, start2, end);
 
         REQUIRE(span1 < span2);
         REQUIRE(span2 > span1);
@@ -1591,21 +1774,21 @@ TEST_CASE("SourceSpan spaceship operator provides correct ordering", "[SourceSpa
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end1(5u, 5u, 100u);
         const jsv::SourceLocation end2(10u, 10u, 500u);
-        const jsv::SourceSpan span1("test.cpp", start, end1);
-        const jsv::SourceSpan span2("test.cpp", start, end2);
+        const jsv::SourceSpan span1(test_file_id, start, end1);
+        const jsv::SourceSpan span2(test_file_id, start, end2);
 
         REQUIRE(span1 < span2);
         REQUIRE(span2 > span1);
     }
 
-    SECTION("lexicographic ordering prioritizes file_path over start") {
-        const auto filePath1 = std::string_view{"a.cpp"};
-        const auto filePath2 = std::string_view{"z.cpp"};
+    SECTION("lexicographic ordering prioritizes file_id over start") {
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
         const jsv::SourceLocation start1(100u, 100u, 10000u);
         const jsv::SourceLocation start2(1u, 1u, 0u);
         const jsv::SourceLocation end;
-        const jsv::SourceSpan span1(filePath1, start1, end);
-        const jsv::SourceSpan span2(filePath2, start2, end);
+        const jsv::SourceSpan span1(fileId1, start1, end);
+        const jsv::SourceSpan span2(fileId2, start2, end);
 
         // File path comparison takes precedence
         REQUIRE(span1 < span2);
@@ -1616,8 +1799,8 @@ TEST_CASE("SourceSpan spaceship operator provides correct ordering", "[SourceSpa
         const jsv::SourceLocation start2(2u, 1u, 50u);
         const jsv::SourceLocation end1(100u, 100u, 10000u);
         const jsv::SourceLocation end2(5u, 5u, 100u);
-        const jsv::SourceSpan span1("test.cpp", start1, end1);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span1(test_file_id, start1, end1);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         // Start comparison takes precedence over end
         REQUIRE(span1 < span2);
@@ -1629,9 +1812,9 @@ TEST_CASE("SourceSpan to_string formats correctly", "[SourceSpan]") {
         const auto filePath = std::string_view{"test/file.cpp"};
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end(3u, 10u, 100u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
-        const std::string result = span.to_string();
+        const std::string result = span.to_string(filePath);
 
 #if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
         REQUIRE(result == "test\\file.cpp:line 1:column 5 - line 3:column 10");
@@ -1643,9 +1826,9 @@ TEST_CASE("SourceSpan to_string formats correctly", "[SourceSpan]") {
     SECTION("single character span") {
         const auto filePath = std::string_view{"main.cpp"};
         const jsv::SourceLocation pos(5u, 10u, 50u);
-        const jsv::SourceSpan span(filePath, pos, pos);
+        const jsv::SourceSpan span(test_file_id, pos, pos);
 
-        const std::string result = span.to_string();
+        const std::string result = span.to_string(filePath);
 
         REQUIRE(result == "main.cpp:line 5:column 10 - line 5:column 10");
     }
@@ -1654,9 +1837,9 @@ TEST_CASE("SourceSpan to_string formats correctly", "[SourceSpan]") {
         const auto filePath = std::string_view{"a/b/c/d/e/file.cpp"};
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(1u, 1u, 10u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
-        const std::string result = span.to_string();
+        const std::string result = span.to_string(filePath);
 
         // Should show ".." + last 2 components (OS-independent)
         REQUIRE(result.find("..") == 0);
@@ -1672,9 +1855,9 @@ TEST_CASE("SourceSpan to_string formats correctly", "[SourceSpan]") {
         const auto filePath = std::string_view{"main.cpp"};
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(1u, 1u, 10u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
-        const std::string result = span.to_string();
+        const std::string result = span.to_string(filePath);
 
         REQUIRE(result == "main.cpp:line 1:column 1 - line 1:column 1");
     }
@@ -1682,39 +1865,43 @@ TEST_CASE("SourceSpan to_string formats correctly", "[SourceSpan]") {
     SECTION("empty file path") {
         const jsv::SourceSpan span;  // default constructed
 
-        const std::string result = span.to_string();
+        const std::string result = span.to_string("");
 
         REQUIRE(result.find(":line 0:column 0 - line 0:column 0") != std::string::npos);
     }
+
+    SECTION("without a path the file id is shown") {
+        const jsv::SourceSpan span(test_file_id, {1u, 5u, 0u}, {3u, 10u, 100u});
+
+        REQUIRE(span.to_string() == "<file 1>:line 1:column 5 - line 3:column 10");
+    }
 }
 
 TEST_CASE("SourceSpan stream operator outputs correctly", "[SourceSpan]") {
     SECTION("typical span") {
-        const auto filePath = std::string_view{"test.cpp"};
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end(3u, 10u, 100u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         std::ostringstream oss;
         oss << span;
 
-        REQUIRE(oss.str() == "test.cpp:line 1:column 5 - line 3:column 10");
+        REQUIRE(oss.str() == "<file 1>:line 1:column 5 - line 3:column 10");
     }
 
     SECTION("chained stream output") {
-        const auto filePath = std::string_view{"test.cpp"};
         const jsv::SourceLocation start1(1u, 1u, 0u);
         const jsv::SourceLocation end1(2u, 2u, 50u);
-        const jsv::SourceSpan span1(filePath, start1, end1);
+        const jsv::SourceSpan span1(test_file_id, start1, end1);
 
         const jsv::SourceLocation start2(3u, 3u, 100u);
         const jsv::SourceLocation end2(4u, 4u, 150u);
-        const jsv::SourceSpan span2(filePath, start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         std::ostringstream oss;
         oss << "From " << span1 << " to " << span2;
 
-        REQUIRE(oss.str() == "From test.cpp:line 1:column 1 - line 2:column 2 to test.cpp:line 3:column 3 - line 4:column 4");
+        REQUIRE(oss.str() == "From <file 1>:line 1:column 1 - line 2:column 2 to <file 1>:line 3:column 3 - line 4:column 4");
     }
 
     SECTION("default constructed span") {
@@ -1730,11 +1917,10 @@ TEST_CASE("SourceSpan stream operator outputs correctly", "[SourceSpan]") {
 
 TEST_CASE("SourceSpan hash function produces consistent results", "[SourceSpan]") {
     SECTION("equal spans produce equal hashes") {
-        const auto filePath = std::string_view{"main.cpp"};
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end(3u, 10u, 100u);
-        const jsv::SourceSpan span1(filePath, start, end);
-        const jsv::SourceSpan span2(filePath, start, end);
+        const jsv::SourceSpan span1(main_file_id, start, end);
+        const jsv::SourceSpan span2(main_file_id, start, end);
 
         const std::hash<jsv::SourceSpan> hasher;
         REQUIRE(hasher(span1) == hasher(span2));
@@ -1744,8 +1930,8 @@ TEST_CASE("SourceSpan hash function produces consistent results", "[SourceSpan]"
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end1(3u, 10u, 100u);
         const jsv::SourceLocation end2(5u, 15u, 200u);
-        const jsv::SourceSpan span1("test.cpp", start, end1);
-        const jsv::SourceSpan span2("test.cpp", start, end2);
+        const jsv::SourceSpan span1(test_file_id, start, end1);
+        const jsv::SourceSpan span2(test_file_id, start, end2);
 
         const std::hash<jsv::SourceSpan> hasher;
         REQUIRE(hasher(span1) != hasher(span2));
@@ -1754,7 +1940,7 @@ TEST_CASE("SourceSpan hash function produces consistent results", "[SourceSpan]"
     SECTION("hash is stable across multiple calls") {
         const jsv::SourceLocation start(1u, 1u, 0u);
         const jsv::SourceLocation end(5u, 5u, 100u);
-        const jsv::SourceSpan span("test.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         const std::hash<jsv::SourceSpan> hasher;
         const std::size_t hash1 = hasher(span);
@@ -1778,31 +1964,30 @@ TEST_CASE("SourceSpan std::format integration", "[SourceSpan]") {
     SECTION("format with default specifier") {
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end(3u, 10u, 100u);
-        const jsv::SourceSpan span("test.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         const std::string result = FORMAT("{}", span);
 
-        REQUIRE(result == "test.cpp:line 1:column 5 - line 3:column 10");
+        REQUIRE(result == "<file 1>:line 1:column 5 - line 3:column 10");
     }
 
     SECTION("format in larger string") {
-        const auto filePath = std::string_view{"main.cpp"};
         const jsv::SourceLocation start(5u, 10u, 50u);
         const jsv::SourceLocation end(10u, 20u, 500u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(main_file_id, start, end);
 
         const std::string result = FORMAT("Error at {}", span);
 
-        REQUIRE(result == "Error at main.cpp:line 5:column 10 - line 10:column 20");
+        REQUIRE(result == "Error at <file 2>:line 5:column 10 - line 10:column 20");
     }
 
     SECTION("format multiple spans") {
-        const jsv::SourceSpan span1("test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u});
-        const jsv::SourceSpan span2("test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u});
+        const jsv::SourceSpan span1(test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u});
+        const jsv::SourceSpan span2(test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u});
 
         const std::string result = FORMAT("From {} to {}", span1, span2);
 
-        REQUIRE(result == "From test.cpp:line 1:column 1 - line 2:column 2 to test.cpp:line 3:column 3 - line 4:column 4");
+        REQUIRE(result == "From <file 1>:line 1:column 1 - line 2:column 2 to <file 1>:line 3:column 3 - line 4:column 4");
     }
 }
 
@@ -1810,38 +1995,36 @@ TEST_CASE("SourceSpan fmt::format integration", "[SourceSpan]") {
     SECTION("fmt::format with default specifier") {
         const jsv::SourceLocation start(1u, 5u, 0u);
         const jsv::SourceLocation end(3u, 10u, 100u);
-        const jsv::SourceSpan span("test.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         const std::string result = fmt::format("{}", span);
 
-        REQUIRE(result == "test.cpp:line 1:column 5 - line 3:column 10");
+        REQUIRE(result == "<file 1>:line 1:column 5 - line 3:column 10");
     }
 
     SECTION("fmt::format in larger string") {
-        const auto filePath = std::string_view{"main.cpp"};
         const jsv::SourceLocation start(5u, 10u, 50u);
         const jsv::SourceLocation end(10u, 20u, 500u);
-        const jsv::SourceSpan span(filePath, start, end);
+        const jsv::SourceSpan span(main_file_id, start, end);
 
         const std::string result = fmt::format("Error at {}", span);
 
-        REQUIRE(result == "Error at main.cpp:line 5:column 10 - line 10:column 20");
+        REQUIRE(result == "Error at <file 2>:line 5:column 10 - line 10:column 20");
     }
 
     SECTION("fmt::format multiple spans") {
-        const jsv::SourceSpan span1("test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u});
-        const jsv::SourceSpan span2("test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u});
+        const jsv::SourceSpan span1(test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u});
+        const jsv::SourceSpan span2(test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u});
 
         const std::string result = fmt::format("From {} to {}", span1, span2);
 
-        REQUIRE(result == "From test.cpp:line 1:column 1 - line 2:column 2 to test.cpp:line 3:column 3 - line 4:column 4");
+        REQUIRE(result == "From <file 1>:line 1:column 1 - line 2:column 2 to <file 1>:line 3:column 3 - line 4:column 4");
     }
 }
 
 TEST_CASE("SourceSpan noexcept guarantees on operations", "[SourceSpan]") {
     SECTION("parameterized constructor is noexcept") {
-        STATIC_REQUIRE(
-            std::is_nothrow_constructible_v<jsv::SourceSpan, std::string_view, const jsv::SourceLocation &, const jsv::SourceLocation &>);
+        STATIC_REQUIRE(std::is_nothrow_constructible_v<jsv::SourceSpan, jsv::FileId, const jsv::SourceLocation &, const jsv::SourceLocation &>);
     }
 
     SECTION("copy constructor is noexcept") { STATIC_REQUIRE(std::is_nothrow_copy_constructible_v<jsv::SourceSpan>); }
@@ -1855,33 +2038,33 @@ TEST_CASE("SourceSpan noexcept guarantees on operations", "[SourceSpan]") {
     SECTION("destructor is noexcept") { STATIC_REQUIRE(std::is_nothrow_destructible_v<jsv::SourceSpan>); }
 
     SECTION("merge does not throw on same file") {
-        jsv::SourceSpan span1("test.cpp", {1u, 1u, 0u}, {5u, 5u, 100u});
-        const jsv::SourceSpan span2("test.cpp", {2u, 2u, 50u}, {10u, 10u, 500u});
+        jsv::SourceSpan span1(test_file_id, {1u, 1u, 0u}, {5u, 5u, 100u});
+        const jsv::SourceSpan span2(test_file_id, {2u, 2u, 50u}, {10u, 10u, 500u});
 
         REQUIRE_NOTHROW(span1.merge(span2));
     }
 
     SECTION("merge does not throw on different files") {
-        const auto filePath1 = std::string_view{"file1.cpp"};
-        const auto filePath2 = std::string_view{"file2.cpp"};
-        jsv::SourceSpan span1(filePath1, {1u, 1u, 0u}, {5u, 5u, 100u});
-        const jsv::SourceSpan span2(filePath2, {2u, 2u, 50u}, {10u, 10u, 500u});
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
+        jsv::SourceSpan span1(fileId1, {1u, 1u, 0u}, {5u, 5u, 100u});
+        const jsv::SourceSpan span2(fileId2, {2u, 2u, 50u}, {10u, 10u, 500u});
 
         REQUIRE_NOTHROW(span1.merge(span2));
     }
 
     SECTION("merged does not throw on same file") {
-        const jsv::SourceSpan span1("test.cpp", {1u, 1u, 0u}, {5u, 5u, 100u});
-        const jsv::SourceSpan span2("test.cpp", {2u, 2u, 50u}, {10u, 10u, 500u});
+        const jsv::SourceSpan span1(test_file_id, {1u, 1u, 0u}, {5u, 5u, 100u});
+        const jsv::SourceSpan span2(test_file_id, {2u, 2u, 50u}, {10u, 10u, 500u});
 
         REQUIRE_NOTHROW(std::ignore = span1.merged(span2));
     }
 
     SECTION("merged does not throw on different files") {
-        const auto filePath1 = std::string_view{"file1.cpp"};
-        const auto filePath2 = std::string_view{"file2.cpp"};
-        const jsv::SourceSpan span1(filePath1, {1u, 1u, 0u}, {5u, 5u, 100u});
-        const jsv::SourceSpan span2(filePath2, {2u, 2u, 50u}, {10u, 10u, 500u});
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
+        const jsv::SourceSpan span1(fileId1, {1u, 1u, 0u}, {5u, 5u, 100u});
+        const jsv::SourceSpan span2(fileId2, {2u, 2u, 50u}, {10u, 10u, 500u});
 
         REQUIRE_NOTHROW(std::ignore = span1.merged(span2));
     }
@@ -1894,8 +2077,9 @@ TEST_CASE("SourceSpan noexcept guarantees on operations", "[SourceSpan]") {
 
     SECTION("to_string does not throw on any state") {
         const auto filePath = std::string_view{"a/b/c/d/e/f/g/file.cpp"};
-        const jsv::SourceSpan span(filePath, {1u, 1u, 0u}, {100u, 100u, 10000u});
+        const jsv::SourceSpan span(test_file_id, {1u, 1u, 0u}, {100u, 100u, 10000u});
         REQUIRE_NOTHROW(std::ignore = span.to_string());
+        REQUIRE_NOTHROW(std::ignore = span.to_string(filePath));
     }
 
     SECTION("stream operator does not throw") {
@@ -1914,9 +2098,9 @@ TEST_CASE("SourceSpan noexcept guarantees on operations", "[SourceSpan]") {
 TEST_CASE("SourceSpan usage in standard containers", "[SourceSpan]") {
     SECTION("can be used as std::vector element") {
         std::vector<jsv::SourceSpan> spans;
-        spans.emplace_back("test.cpp", jsv::SourceLocation{1u, 1u, 0u}, jsv::SourceLocation{2u, 2u, 50u});
-        spans.emplace_back("test.cpp", jsv::SourceLocation{3u, 3u, 100u}, jsv::SourceLocation{4u, 4u, 150u});
-        spans.emplace_back("test.cpp", jsv::SourceLocation{5u, 5u, 200u}, jsv::SourceLocation{6u, 6u, 250u});
+        spans.emplace_back(test_file_id, jsv::SourceLocation{1u, 1u, 0u}, jsv::SourceLocation{2u, 2u, 50u});
+        spans.emplace_back(test_file_id, jsv::SourceLocation{3u, 3u, 100u}, jsv::SourceLocation{4u, 4u, 150u});
+        spans.emplace_back(test_file_id, jsv::SourceLocation{5u, 5u, 200u}, jsv::SourceLocation{6u, 6u, 250u});
 
         REQUIRE(spans.size() == 3u);
         REQUIRE(spans[0].start.line == 1u);
@@ -1926,30 +2110,30 @@ TEST_CASE("SourceSpan usage in standard containers", "[SourceSpan]") {
 
     SECTION("can be used as std::map key") {
         std::map<jsv::SourceSpan, std::string> spanMap;
-        spanMap[{"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}}] = "first";
-        spanMap[{"test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u}}] = "second";
-        spanMap[{"test.cpp", {5u, 5u, 200u}, {6u, 6u, 250u}}] = "third";
+        spanMap[{test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}}] = "first";
+        spanMap[{test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u}}] = "second";
+        spanMap[{test_file_id, {5u, 5u, 200u}, {6u, 6u, 250u}}] = "third";
 
         REQUIRE(spanMap.size() == 3u);
-        REQUIRE(spanMap.at({"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}}) == "first");
-        REQUIRE(spanMap.at({"test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u}}) == "second");
+        REQUIRE(spanMap.at({test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}}) == "first");
+        REQUIRE(spanMap.at({test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u}}) == "second");
     }
 
     SECTION("can be used as std::unordered_map key with custom hash") {
         std::unordered_map<jsv::SourceSpan, std::string, std::hash<jsv::SourceSpan>> spanMap;
-        spanMap[{"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}}] = "first";
-        spanMap[{"test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u}}] = "second";
+        spanMap[{test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}}] = "first";
+        spanMap[{test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u}}] = "second";
 
         REQUIRE(spanMap.size() == 2u);
-        REQUIRE(spanMap.at({"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}}) == "first");
+        REQUIRE(spanMap.at({test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}}) == "first");
     }
 
     SECTION("can be used in std::set") {
         std::set<jsv::SourceSpan> spanSet;
-        spanSet.insert({"test.cpp", {3u, 3u, 100u}, {4u, 4u, 150u}});
-        spanSet.insert({"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}});
-        spanSet.insert({"test.cpp", {5u, 5u, 200u}, {6u, 6u, 250u}});
-        spanSet.insert({"test.cpp", {1u, 1u, 0u}, {2u, 2u, 50u}});  // duplicate
+        spanSet.insert({test_file_id, {3u, 3u, 100u}, {4u, 4u, 150u}});
+        spanSet.insert({test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}});
+        spanSet.insert({test_file_id, {5u, 5u, 200u}, {6u, 6u, 250u}});
+        spanSet.insert({test_file_id, {1u, 1u, 0u}, {2u, 2u, 50u}});  // duplicate
 
         REQUIRE(spanSet.size() == 3u);
         REQUIRE(spanSet.begin()->start.line == 1u);           // smallest
@@ -1962,7 +2146,7 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
         constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
         const jsv::SourceLocation start(max, max, max);
         const jsv::SourceLocation end(max, max, max);
-        const jsv::SourceSpan span("test.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         REQUIRE(span.start.line == max);
         REQUIRE(span.end.line == max);
@@ -1974,7 +2158,7 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
 
     SECTION("empty span (start equals end)") {
         const jsv::SourceLocation pos(5u, 10u, 100u);
-        const jsv::SourceSpan span("test.cpp", pos, pos);
+        const jsv::SourceSpan span(test_file_id, pos, pos);
 
         REQUIRE(span.start == span.end);
         REQUIRE(span.start.line == 5u);
@@ -1984,7 +2168,7 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
     SECTION("span with end before start (valid but unusual)") {
         const jsv::SourceLocation start(10u, 10u, 500u);
         const jsv::SourceLocation end(5u, 5u, 100u);
-        const jsv::SourceSpan span("test.cpp", start, end);
+        const jsv::SourceSpan span(test_file_id, start, end);
 
         // This is technically valid - just represents an inverted span
         REQUIRE(span.start.line == 10u);
@@ -1992,11 +2176,11 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
     }
 
     SECTION("comparison with mixed extreme values") {
-        const auto filePath1 = std::string_view{"a.cpp"};
-        const auto filePath2 = std::string_view{"z.cpp"};
-        const jsv::SourceSpan small(filePath1, {0u, 0u, 0u}, {0u, 0u, 0u});
+        const auto fileId1 = jsv::FileId{3};
+        const auto fileId2 = jsv::FileId{4};
+        const jsv::SourceSpan small(fileId1, {0u, 0u, 0u}, {0u, 0u, 0u});
         constexpr std::size_t max = std::numeric_limits<std::size_t>::max();
-        const jsv::SourceSpan large(filePath2, {max, max, max}, {max, max, max});
+        const jsv::SourceSpan large(fileId2, {max, max, max}, {max, max, max});
 
         REQUIRE(small < large);
         REQUIRE(large > small);
@@ -2004,7 +2188,7 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
     }
 
     SECTION("self-comparison") {
-        const jsv::SourceSpan span("test.cpp", {42u, 42u, 420u}, {84u, 84u, 840u});
+        const jsv::SourceSpan span(test_file_id, {42u, 42u, 420u}, {84u, 84u, 840u});
 
         REQUIRE(span == span);
         REQUIRE_FALSE(span != span);
@@ -2017,18 +2201,18 @@ TEST_CASE("SourceSpan edge cases with extreme values", "[SourceSpan]") {
 
 TEST_CASE("SourceSpan copy and move semantics", "[SourceSpan]") {
     SECTION("copy construction preserves all fields") {
-        const jsv::SourceSpan original("test.cpp", {10u, 20u, 100u}, {30u, 40u, 300u});
+        const jsv::SourceSpan original(test_file_id, {10u, 20u, 100u}, {30u, 40u, 300u});
         const jsv::SourceSpan copied = original;
 
-        REQUIRE(copied.file_path == original.file_path);
+        REQUIRE(copied.file_id == original.file_id);
         REQUIRE(copied.start == original.start);
         REQUIRE(copied.end == original.end);
         REQUIRE(copied == original);
     }
 
     SECTION("copy assignment preserves all fields") {
-        jsv::SourceSpan loc1("test.cpp", {1u, 2u, 3u}, {4u, 5u, 6u});
-        const jsv::SourceSpan loc2("test.cpp", {10u, 20u, 100u}, {30u, 40u, 300u});
+        jsv::SourceSpan loc1(test_file_id, {1u, 2u, 3u}, {4u, 5u, 6u});
+        const jsv::SourceSpan loc2(test_file_id, {10u, 20u, 100u}, {30u, 40u, 300u});
 
         loc1 = loc2;
 
@@ -2038,7 +2222,7 @@ TEST_CASE("SourceSpan copy and move semantics", "[SourceSpan]") {
     }
 
     SECTION("move construction preserves all fields") {
-        jsv::SourceSpan original("test.cpp", {10u, 20u, 100u}, {30u, 40u, 300u});
+        jsv::SourceSpan original(test_file_id, {10u, 20u, 100u}, {30u, 40u, 300u});
         const jsv::SourceSpan moved = std::move(original);
 
         REQUIRE(moved.start.line == 10u);
@@ -2046,8 +2230,8 @@ TEST_CASE("SourceSpan copy and move semantics", "[SourceSpan]") {
     }
 
     SECTION("move assignment preserves all fields") {
-        jsv::SourceSpan loc1("test.cpp", {1u, 2u, 3u}, {4u, 5u, 6u});
-        jsv::SourceSpan loc2("test.cpp", {10u, 20u, 100u}, {30u, 40u, 300u});
+        jsv::SourceSpan loc1(test_file_id, {1u, 2u, 3u}, {4u, 5u, 6u});
+        jsv::SourceSpan loc2(test_file_id, {10u, 20u, 100u}, {30u, 40u, 300u});
 
         loc1 = std::move(loc2);
 
@@ -2056,7 +2240,7 @@ TEST_CASE("SourceSpan copy and move semantics", "[SourceSpan]") {
     }
 
     SECTION("self-assignment is safe") {
-        const jsv::SourceSpan span("test.cpp", {42u, 42u, 420u}, {84u, 84u, 840u});
+        const jsv::SourceSpan span(test_file_id, {42u, 42u, 420u}, {84u, 84u, 840u});
 
         // Copy self-assignment verified by copying to a new instance
         const jsv::SourceSpan span_copy = span;
@@ -2152,8 +2336,7 @@ TEST_CASE("HasSpan abstract interface works correctly", "[HasSpan][interface][po
     };
 
     SECTION("can store and retrieve span through interface") {
-        const auto filePath = std::string_view{"test.cpp"};
-        const jsv::SourceSpan span(filePath, {1u, 1u, 0u}, {5u, 5u, 100u});
+        const jsv::SourceSpan span(test_file_id, {1u, 1u, 0u}, {5u, 5u, 100u});
 
         const TestHasSpan has_span(span);
 
@@ -2161,7 +2344,7 @@ TEST_CASE("HasSpan abstract interface works correctly", "[HasSpan][interface][po
     }
 
     SECTION("polymorphic access through base pointer") {
-        const jsv::SourceSpan span("test.cpp", {10u, 20u, 100u}, {30u, 40u, 300u});
+        const jsv::SourceSpan span(test_file_id, {10u, 20u, 100u}, {30u, 40u, 300u});
 
         const std::unique_ptr<jsv::HasSpan> ptr = std::make_unique<TestHasSpan>(span);
 
@@ -2169,7 +2352,7 @@ TEST_CASE("HasSpan abstract interface works correctly", "[HasSpan][interface][po
     }
 
     SECTION("polymorphic access through base reference") {
-        const jsv::SourceSpan span("test.cpp", {5u, 10u, 50u}, {15u, 20u, 150u});
+        const jsv::SourceSpan span(test_file_id, {5u, 10u, 50u}, {15u, 20u, 150u});
 
         const TestHasSpan has_span(span);
         const jsv::HasSpan &ref = has_span;
@@ -2180,7 +2363,7 @@ TEST_CASE("HasSpan abstract interface works correctly", "[HasSpan][interface][po
     SECTION("virtual destructor is noexcept") { STATIC_REQUIRE(std::is_nothrow_destructible_v<jsv::HasSpan>); }
 
     SECTION("span method is noexcept") {
-        const TestHasSpan has_span({"test.cpp", {1u, 1u, 0u}, {5u, 5u, 100u}});
+        const TestHasSpan has_span({test_file_id, {1u, 1u, 0u}, {5u, 5u, 100u}});
 
         REQUIRE_NOTHROW(std::ignore = has_span.span());
     }
@@ -2192,14 +2375,14 @@ TEST_CASE("HasSpan abstract interface works correctly", "[HasSpan][interface][po
 TEST_CASE("Token construction and basic accessors", "[Token]") {
     const jsv::SourceLocation start(1u, 5u, 10u);
     const jsv::SourceLocation end(1u, 8u, 13u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("Token constructed with all parameters") {
         const jsv::Token token(jsv::TokenKind::KeywordFun, "fun", span);
 
         REQUIRE(token.getKind() == jsv::TokenKind::KeywordFun);
         REQUIRE(token.getText() == "fun");
-        REQUIRE(token.getSpan().file_path == "test.cpp");
+        REQUIRE(token.getSpan().file_id == test_file_id);
         REQUIRE(token.getSpan().start.line == 1u);
         REQUIRE(token.getSpan().start.column == 5u);
         REQUIRE(token.getSpan().end.line == 1u);
@@ -2236,7 +2419,7 @@ TEST_CASE("Token construction and basic accessors", "[Token]") {
 TEST_CASE("Token copy and move semantics", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("Token copy constructor") {
         const jsv::Token original(jsv::TokenKind::KeywordIf, "if", span);
@@ -2291,7 +2474,7 @@ TEST_CASE("Token copy and move semantics", "[Token]") {
 TEST_CASE("Token equality and comparison operators", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("Equal tokens compare equal") {
         const jsv::Token token1(jsv::TokenKind::KeywordFun, "fun", span);
@@ -2319,7 +2502,7 @@ TEST_CASE("Token equality and comparison operators", "[Token]") {
     SECTION("Tokens with different span are not equal") {
         const jsv::SourceLocation start2(2u, 1u, 10u);
         const jsv::SourceLocation end2(2u, 5u, 14u);
-        const jsv::SourceSpan span2("test.cpp", start2, end2);
+        const jsv::SourceSpan span2(test_file_id, start2, end2);
 
         const jsv::Token token1(jsv::TokenKind::KeywordIf, "if", span);
         const jsv::Token token2(jsv::TokenKind::KeywordIf, "if", span2);
@@ -2340,60 +2523,60 @@ TEST_CASE("Token equality and comparison operators", "[Token]") {
 TEST_CASE("Token to_string method", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("to_string for keyword token") {
         const jsv::Token token(jsv::TokenKind::KeywordFun, "fun", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(FUN("fun") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for operator token") {
         const jsv::Token token(jsv::TokenKind::PlusEqual, "+=", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(PLUS_EQUAL("+=") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for identifier token") {
         const jsv::Token token(jsv::TokenKind::IdentifierAscii, "myVariable", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(IDENTIFIER("myVariable") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for numeric literal token") {
         const jsv::Token token(jsv::TokenKind::Numeric, "123.456", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(NUMERIC("123.456") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for string literal token") {
         const jsv::Token token(jsv::TokenKind::StringLiteral, R"(hello "world")", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(STRING("hello "world"") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for type token") {
         const jsv::Token token(jsv::TokenKind::TypeI32, "i32", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(I32("i32") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for EOF token") {
         const jsv::Token token(jsv::TokenKind::Eof, "", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(EOF("") test.cpp:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("to_string for error token") {
         const jsv::Token token(jsv::TokenKind::Error, "@invalid", span);
-        const std::string result = token.to_string();
+        const std::string result = token.to_string("test.cpp");
 
         REQUIRE(result == R"(ERROR("@invalid") test.cpp:line 1:column 1 - line 1:column 5)");
     }
@@ -2402,14 +2585,14 @@ TEST_CASE("Token to_string method", "[Token]") {
 TEST_CASE("Token stream output operator", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("ostream operator outputs to_string result") {
         const jsv::Token token(jsv::TokenKind::KeywordReturn, "return", span);
         std::ostringstream oss;
         oss << token;
 
-        REQUIRE(oss.str() == R"(RETURN("return") test.cpp:line 1:column 1 - line 1:column 5)");
+        REQUIRE(oss.str() == R"(RETURN("return") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("ostream operator with multiple tokens") {
@@ -2420,7 +2603,7 @@ TEST_CASE("Token stream output operator", "[Token]") {
         oss << token1 << " else " << token2;
 
         REQUIRE(oss.str() ==
-                R"(IF("if") test.cpp:line 1:column 1 - line 1:column 5 else ELSE("else") test.cpp:line 1:column 1 - line 1:column 5)");
+                R"(IF("if") <file 1>:line 1:column 1 - line 1:column 5 else ELSE("else") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("ostream operator preserves stream state") {
@@ -2438,20 +2621,20 @@ TEST_CASE("Token stream output operator", "[Token]") {
 TEST_CASE("Token std::formatter integration", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("std::format with default format") {
         const jsv::Token token(jsv::TokenKind::KeywordFor, "for", span);
         const std::string result = std::format("{}", token);
 
-        REQUIRE(result == R"(FOR("for") test.cpp:line 1:column 1 - line 1:column 5)");
+        REQUIRE(result == R"(FOR("for") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("std::format in format string") {
         const jsv::Token token(jsv::TokenKind::KeywordWhile, "while", span);
         const std::string result = std::format("Token: {}", token);
 
-        REQUIRE(result == R"(Token: WHILE("while") test.cpp:line 1:column 1 - line 1:column 5)");
+        REQUIRE(result == R"(Token: WHILE("while") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("std::format with multiple tokens") {
@@ -2463,34 +2646,34 @@ TEST_CASE("Token std::formatter integration", "[Token]") {
         // "(()" + "())" = "((())())"
         REQUIRE(
             result ==
-            "OPEN_PAREN(\"(\") test.cpp:line 1:column 1 - line 1:column 5 CLOSE_PAREN(\")\") test.cpp:line 1:column 1 - line 1:column 5");
+            "OPEN_PAREN(\"(\") <file 1>:line 1:column 1 - line 1:column 5 CLOSE_PAREN(\")\") <file 1>:line 1:column 1 - line 1:column 5");
     }
 }
 
 TEST_CASE("Token fmt::formatter integration", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("fmt::format with default format") {
         const jsv::Token token(jsv::TokenKind::KeywordMain, "main", span);
         const std::string result = fmt::format("{}", token);
 
-        REQUIRE(result == R"(MAIN("main") test.cpp:line 1:column 1 - line 1:column 5)");
+        REQUIRE(result == R"(MAIN("main") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 
     SECTION("fmt::format in format string") {
         const jsv::Token token(jsv::TokenKind::KeywordVar, "var", span);
         const std::string result = fmt::format("Token: {}", token);
 
-        REQUIRE(result == R"(Token: VAR("var") test.cpp:line 1:column 1 - line 1:column 5)");
+        REQUIRE(result == R"(Token: VAR("var") <file 1>:line 1:column 1 - line 1:column 5)");
     }
 }
 
 TEST_CASE("Token corner cases and edge cases", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 1u, 0u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("Token with very long text") {
         const std::string longText(1000, 'a');
@@ -2514,7 +2697,7 @@ TEST_CASE("Token corner cases and edge cases", "[Token]") {
 
     SECTION("Token at position zero") {
         const jsv::SourceLocation zeroLoc(0u, 0u, 0u);
-        const jsv::SourceSpan zeroSpan("test.cpp", zeroLoc, zeroLoc);
+        const jsv::SourceSpan zeroSpan(test_file_id, zeroLoc, zeroLoc);
         const jsv::Token token(jsv::TokenKind::Eof, "", zeroSpan);
 
         REQUIRE(token.getSpan().start.line == 0u);
@@ -2528,7 +2711,7 @@ TEST_CASE("Token corner cases and edge cases", "[Token]") {
         constexpr std::size_t largeOffset = std::numeric_limits<std::size_t>::max() - 100u;
 
         const jsv::SourceLocation largeLoc(largeLine, largeCol, largeOffset);
-        const jsv::SourceSpan largeSpan("test.cpp", largeLoc, largeLoc);
+        const jsv::SourceSpan largeSpan(test_file_id, largeLoc, largeLoc);
         const jsv::Token token(jsv::TokenKind::IdentifierAscii, "x", largeSpan);
 
         REQUIRE(token.getSpan().start.line == largeLine);
@@ -2540,7 +2723,7 @@ TEST_CASE("Token corner cases and edge cases", "[Token]") {
 TEST_CASE("Token noexcept contracts", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     STATIC_REQUIRE(std::is_nothrow_copy_constructible_v<jsv::Token>);
     STATIC_REQUIRE(std::is_nothrow_copy_assignable_v<jsv::Token>);
@@ -2596,7 +2779,7 @@ TEST_CASE("Token noexcept contracts", "[Token]") {
 TEST_CASE("Token data-driven tests", "[Token]") {
     const jsv::SourceLocation start(1u, 1u, 0u);
     const jsv::SourceLocation end(1u, 5u, 4u);
-    const jsv::SourceSpan span("test.cpp", start, end);
+    const jsv::SourceSpan span(test_file_id, start, end);
 
     SECTION("various keyword tokens") {
         auto [kind, text, expected] = GENERATE(table<jsv::TokenKind, const char *, const char *>({
@@ -2613,7 +2796,7 @@ TEST_CASE("Token data-driven tests", "[Token]") {
         CAPTURE(kind, text, expected);
 
         const jsv::Token token(kind, text, span);
-        REQUIRE(token.to_string() == expected);
+        REQUIRE(token.to_string("test.cpp") == expected);
     }
 
     SECTION("various operator tokens") {
@@ -4322,6 +4505,2172 @@ TEST_CASE("Lexer_NumericNewlineTermination_FR028", "[lexer][numeric][us5][fr-028
     }
 }
 
+// ==========================================================================
+// Block scanners (simd/ByteScan.hpp) — whitespace and line comments
+// ==========================================================================
+
+TEST_CASE("ByteScan_SkipHorizontalSpace_MatchesScalarReference", "[lexer][simd]") {
+    // Cover every block/tail alignment: the run length and the stop byte vary
+    // across the 16- and 32-byte block boundaries.
+    static constexpr std::array<char, 6> stops{'x', '\n', '\0', '/', '\x80', '\xff'};
+    for(std::size_t lead = 0; lead < 70; ++lead) {
+        for(const char stop : stops) {
+            std::string src(lead, ' ');
+            for(std::size_t i = 0; i < lead; ++i) { src[i] = " \t\r\v\f"[i % 5]; }
+            src += stop;
+            src += "   ";
+            CAPTURE(lead, static_cast<int>(stop));
+            REQUIRE(jsv::simd::skip_horizontal_space(src, 0) == jsv::simd::detail::skip_horizontal_space_scalar(src, 0));
+            REQUIRE(jsv::simd::skip_horizontal_space(src, 0) == lead);
+        }
+    }
+    SECTION("whitespace up to the end of input") {
+        const std::string src(100, '\t');
+        REQUIRE(jsv::simd::skip_horizontal_space(src, 0) == src.size());
+        REQUIRE(jsv::simd::skip_horizontal_space(src, src.size()) == src.size());
+    }
+}
+
+TEST_CASE("ByteScan_BlockMasks_MatchScalarPredicates", "[lexer][simd]") {
+    // Every byte value in every lane of the block kernels this build runs,
+    // against the predicates the `detail::` scalar references use.
+#ifdef JSV_SIMD_SSE2
+    using namespace jsv::simd::detail;
+    std::string bytes;
+    for(int i = 0; i < 256 + 32; ++i) { bytes += static_cast<char>(i % 256); }
+    const auto expected = [&bytes](const std::size_t pos, const std::size_t width, auto predicate) {
+        std::uint32_t mask = 0;
+        for(std::size_t k = 0; k < width; ++k) { mask |= predicate(bytes[pos + k]) ? 1U << k : 0U; }
+        return mask;
+    };
+    for(std::size_t pos = 0; pos < 256; ++pos) {
+        CAPTURE(pos);
+        const auto block16 = load16(bytes, pos);
+        REQUIRE(hspace_mask16(block16) == expected(pos, 16, jsv::is_ascii_horizontal_space));
+        REQUIRE(string_special_mask16(block16) == expected(pos, 16, is_string_special));
+        REQUIRE(line_break_lead_mask16(block16) == expected(pos, 16, is_line_break_lead));
+#ifdef JSV_SIMD_AVX2
+        const auto block32 = load32(bytes, pos);
+        REQUIRE(hspace_mask32(block32) == expected(pos, 32, jsv::is_ascii_horizontal_space));
+        REQUIRE(string_special_mask32(block32) == expected(pos, 32, is_string_special));
+        REQUIRE(line_break_lead_mask32(block32) == expected(pos, 32, is_line_break_lead));
+#endif
+    }
+#else
+    SKIP("no SIMD block kernels on this target");
+#endif
+}
+
+TEST_CASE("ByteScan_FindByte_MatchesScalarReference", "[lexer][simd]") {
+    for(std::size_t at = 0; at < 70; ++at) {
+        std::string src(at, 'c');
+        src += '\n';
+        src += std::string(40, 'c');
+        for(std::size_t from = 0; from <= at; from += 7) {
+            CAPTURE(at, from);
+            REQUIRE(jsv::simd::find_byte(src, from, '\n') == at);
+            REQUIRE(jsv::simd::find_byte(src, from, '\n') == jsv::simd::detail::find_byte_scalar(src, from, '\n'));
+        }
+    }
+    SECTION("missing needle returns size") {
+        const std::string src(77, 'c');
+        REQUIRE(jsv::simd::find_byte(src, 0, '\n') == src.size());
+        REQUIRE(jsv::simd::find_byte(src, 3, 'x') == src.size());
+    }
+}
+
+TEST_CASE("Lexer_LongIndentation_ColumnIsExact", "[lexer][simd][whitespace]") {
+    const std::string src = std::string(37, ' ') + "a\n" + std::string(65, '\t') + "b \f\v\r c";
+    jsv::Lexer lex{src, "test.jsav"};
+    const auto tokens = lex.tokenize();
+    REQUIRE(tokens.size() == 4);
+    REQUIRE(tokens[0].getSpan().start.line == 1);
+    REQUIRE(tokens[0].getSpan().start.column == 38);
+    REQUIRE(tokens[0].getSpan().start.absolute_pos == 37);
+    REQUIRE(tokens[1].getSpan().start.line == 2);
+    REQUIRE(tokens[1].getSpan().start.column == 66);
+    REQUIRE(tokens[2].getText() == "c");
+    REQUIRE(tokens[2].getSpan().start.column == 72);
+    REQUIRE(tokens[3].getSpan().start.column == 73);
+}
+
+TEST_CASE("Lexer_LongLineComment_SkippedToNewline", "[lexer][simd][comments]") {
+    SECTION("comment followed by a newline") {
+        const std::string src = "x // " + std::string(90, '-') + "\xc3\xa9 *\"/ \n  y";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[1].getText() == "y");
+        REQUIRE(tokens[1].getSpan().start.line == 2);
+        REQUIRE(tokens[1].getSpan().start.column == 3);
+    }
+    SECTION("comment running to end of input") {
+        const std::string src = "x //" + std::string(50, 'c');
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[1].getKind() == jsv::TokenKind::Eof);
+        REQUIRE(tokens[1].getSpan().start.column == src.size() + 1);
+        REQUIRE(tokens[1].getSpan().start.absolute_pos == src.size());
+    }
+    SECTION("bare // at end of input") {
+        jsv::Lexer lex{"//", "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 1);
+        REQUIRE(tokens[0].getSpan().start.column == 3);
+    }
+}
+
+TEST_CASE("ByteScan_ScanStringBody_MatchesScalarReference", "[lexer][simd][string]") {
+    static constexpr std::array<char, 5> stops{'"', '\\', '\n', '\r', 'x'};
+    for(std::size_t len = 0; len < 70; ++len) {
+        for(std::size_t hi = 0; hi <= len + 1; hi += 9) {
+            for(const char stop : stops) {
+                std::string src(len, 'a');
+                if(hi < len) { src[hi] = '\xc3'; }
+                src += stop;
+                src += "\xe2\x82\xac tail";
+                CAPTURE(len, hi, static_cast<int>(stop));
+                const auto fast = jsv::simd::scan_string_body(src, 0);
+                const auto slow = jsv::simd::detail::scan_string_body_scalar(src, 0);
+                REQUIRE(fast.end == slow.end);
+                REQUIRE(fast.has_non_ascii == slow.has_non_ascii);
+                REQUIRE(fast.has_non_ascii == (hi < len || (stop == 'x')));
+            }
+        }
+    }
+}
+
+TEST_CASE("Lexer_LongStringLiteral_ScannedAsOneToken", "[lexer][simd][string]") {
+    SECTION("clean ASCII body with escapes") {
+        const std::string body = std::string(45, 'a') + "\\\"" + std::string(40, 'b') + "\\u00e9" + std::string(20, 'c');
+        const std::string src = "\"" + body + "\" x";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::StringLiteral);
+        REQUIRE(tokens[0].getText() == "\"" + body + "\"");
+        REQUIRE(tokens[0].getSpan().end.column == body.size() + 3);
+        REQUIRE(tokens[1].getSpan().start.column == body.size() + 4);
+    }
+    SECTION("valid multi-byte runs across block boundaries") {
+        std::string body;
+        for(int i = 0; i < 30; ++i) { body += "ab\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80"; }
+        const std::string src = "\"" + body + "\"";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::StringLiteral);
+        REQUIRE(tokens[0].getSpan().end.column == src.size() + 1);
+    }
+    SECTION("one malformed byte deep inside the body") {
+        std::string body(100, 'z');
+        body[77] = '\xff';
+        const std::string src = "\"" + body + "\" y";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::Error);
+        REQUIRE(tokens[0].getText() == "\"" + body + "\"");
+        REQUIRE(tokens[1].getText() == "y");
+    }
+    SECTION("sequence truncated by the closing quote") {
+        const std::string src = std::string("\"") + std::string(33, 'q') + "\xe4\xb8\"";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::Error);
+        REQUIRE(tokens[0].getText() == src);
+    }
+    SECTION("unterminated string stops at the line break") {
+        const std::string src = "\"" + std::string(50, 'u') + "\nnext";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::StringLiteral);
+        REQUIRE(tokens[0].getText().size() == 51);
+        REQUIRE(tokens[1].getSpan().start.line == 2);
+    }
+}
+
+TEST_CASE("ByteScan_FindBlockCommentEnd_MatchesScalarReference", "[lexer][simd][comments]") {
+    for(std::size_t at = 0; at < 75; ++at) {
+        // Lone '*' and '/' bytes before the terminator must not match.
+        std::string src(at, 'c');
+        for(std::size_t i = 0; i < at; i += 5) { src[i] = (i % 2 == 0) ? '*' : '/'; }
+        src += "*/";
+        src += std::string(40, '*');
+        CAPTURE(at);
+        REQUIRE(jsv::simd::find_block_comment_end(src, 0) == jsv::simd::detail::find_block_comment_end_scalar(src, 0));
+    }
+    SECTION("unterminated comment returns size") {
+        const std::string src = std::string(70, '*') + "x/";
+        REQUIRE(jsv::simd::find_block_comment_end(src, 0) == src.size());
+        REQUIRE(jsv::simd::find_block_comment_end("*", 0) == 1);
+    }
+}
+
+TEST_CASE("Lexer_LargeBlockComment_LineColumnExact", "[lexer][simd][comments]") {
+    SECTION("license-style header") {
+        std::string header = "/*\n";
+        for(int i = 0; i < 40; ++i) { header += " * Licensed under the terms \xc3\xa9 of the license, line " + std::to_string(i) + "\n"; }
+        header += " */";
+        const std::string src = header + "  fun";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::KeywordFun);
+        REQUIRE(tokens[0].getSpan().start.line == 42);
+        REQUIRE(tokens[0].getSpan().start.column == 6);
+        REQUIRE(tokens[0].getSpan().start.absolute_pos == header.size() + 2);
+    }
+    SECTION("comment without newlines keeps counting columns") {
+        const std::string src = "a /*" + std::string(60, '*') + "*/b";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[1].getText() == "b");
+        REQUIRE(tokens[1].getSpan().start.line == 1);
+        REQUIRE(tokens[1].getSpan().start.column == src.size());
+    }
+    SECTION("unterminated comment swallows the rest of the input") {
+        const std::string src = "x /* never closed\n" + std::string(50, 'z') + "\n*";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[1].getKind() == jsv::TokenKind::Eof);
+        REQUIRE(tokens[1].getSpan().start.line == 3);
+        REQUIRE(tokens[1].getSpan().start.column == 2);
+    }
+    SECTION("Unicode line terminators inside a comment count as lines") {
+        const std::string src = "/* \xe2\x80\xa8 \xc2\x85 */y";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens[0].getSpan().start.line == 3);
+        REQUIRE(tokens[0].getSpan().start.column == 4);
+    }
+}
+
+// ==========================================================================
+// Character-class table (CharClass.hpp)
+// ==========================================================================
+
+namespace {
+    std::string load_vn_corpus(std::size_t min_size) {
+        std::string corpus;
+        for(const auto &entry : fs::directory_iterator(JSAV_VN_FILES_DIR)) {
+            if(entry.path().extension() == ".vn") {
+                corpus += vnd::readFromFile(entry.path().string());
+                corpus += '\n';
+            }
+        }
+        if(corpus.empty()) { return corpus; }
+        const auto unit = corpus;
+        while(corpus.size() < min_size) { corpus += unit; }
+        return corpus;
+    }
+}  // namespace
+
+TEST_CASE("CharClass_Table_MatchesCctypeInCLocale", "[lexer][charclass]") {
+    for(int b = 0; b < 256; ++b) {
+        const auto c = static_cast<char>(b);
+        CAPTURE(b);
+        REQUIRE(jsv::is_ascii_digit(c) == (std::isdigit(b) != 0));
+        REQUIRE(jsv::is_ascii_hex_digit(c) == (std::isxdigit(b) != 0));
+        REQUIRE(jsv::is_ascii_alnum(c) == (std::isalnum(b) != 0));
+        REQUIRE(jsv::is_ascii_ident_start(c) == ((std::isalpha(b) != 0) || c == '_'));
+        REQUIRE(jsv::is_ascii_ident_continue(c) == ((std::isalnum(b) != 0) || c == '_'));
+        REQUIRE(jsv::has_char_class(c, jsv::CharClass::NonAscii) == (b > 0x7F));
+    }
+}
+
+TEST_CASE("CharClass_Microbenchmark_VnFilesCorpus", "[lexer][charclass][performance]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 20U);
+    REQUIRE_FALSE(corpus.empty());
+
+    const auto count_cctype = [&corpus] {
+        std::size_t hits = 0;
+        for(const char c : corpus) {
+            const auto b = static_cast<unsigned char>(c);
+            hits += static_cast<std::size_t>((std::isalnum(b) != 0) || c == '_') + static_cast<std::size_t>(std::isdigit(b) != 0) +
+                    static_cast<std::size_t>(std::isxdigit(b) != 0);
+        }
+        return hits;
+    };
+    const auto count_table = [&corpus] {
+        std::size_t hits = 0;
+        for(const char c : corpus) {
+            hits += static_cast<std::size_t>(jsv::is_ascii_ident_continue(c)) + static_cast<std::size_t>(jsv::is_ascii_digit(c)) +
+                    static_cast<std::size_t>(jsv::is_ascii_hex_digit(c));
+        }
+        return hits;
+    };
+    REQUIRE(count_cctype() == count_table());
+
+    BENCHMARK("Classify vn_files corpus with <cctype>") { return count_cctype(); };
+    BENCHMARK("Classify vn_files corpus with char_class_table") { return count_table(); };
+    BENCHMARK("Tokenize vn_files corpus") {
+        jsv::Lexer bench_lex{corpus, "bench.vn"};
+        return bench_lex.tokenize();
+    };
+}
+
+TEST_CASE("Keywords_PerfectHash_EveryKeywordAndNearMiss", "[lexer][keyword]") {
+    using namespace jsv;
+    SECTION("every table entry maps to its own kind") {
+        for(const auto &entry : keyword_list) { REQUIRE(classify_keyword(entry.text) == entry.kind); }
+    }
+    SECTION("prefixes, extensions and one-byte edits are identifiers") {
+        for(const auto &entry : keyword_list) {
+            const std::string word{entry.text};
+            REQUIRE(classify_keyword(word.substr(0, word.size() - 1)) == TokenKind::IdentifierAscii);
+            REQUIRE(classify_keyword(word + "x") == TokenKind::IdentifierAscii);
+            REQUIRE(classify_keyword("_" + word) == TokenKind::IdentifierAscii);
+            for(std::size_t i = 0; i < word.size(); ++i) {
+                std::string edited = word;
+                edited[i] = edited[i] == 'Q' ? 'R' : 'Q';
+                REQUIRE(classify_keyword(edited) == TokenKind::IdentifierAscii);
+            }
+        }
+    }
+    SECTION("lexer output is unchanged") {
+        Lexer lexer{"fun main while whilex u8 u88 nullptr", "kw.vn"};
+        const auto tokens = lexer.tokenize();
+        REQUIRE(tokens.size() == 8);
+        REQUIRE(tokens[0].getKind() == TokenKind::KeywordFun);
+        REQUIRE(tokens[1].getKind() == TokenKind::KeywordMain);
+        REQUIRE(tokens[2].getKind() == TokenKind::KeywordWhile);
+        REQUIRE(tokens[3].getKind() == TokenKind::IdentifierAscii);
+        REQUIRE(tokens[4].getKind() == TokenKind::TypeU8);
+        REQUIRE(tokens[5].getKind() == TokenKind::IdentifierAscii);
+        REQUIRE(tokens[6].getKind() == TokenKind::KeywordNullptr);
+    }
+}
+
+TEST_CASE("CompactToken_TokenizeCompact_MatchesFullTokens", "[lexer][compact]") {
+    const auto check = [](const std::string &src) {
+        CAPTURE(src);
+        jsv::Lexer full_lexer{src, "compact.vn", 7};
+        const auto tokens = full_lexer.tokenize();
+        jsv::Lexer compact_lexer{src, "compact.vn"};
+        const auto compact = compact_lexer.tokenize_compact(7);
+        const jsv::SourceFile source{src, "compact.vn", 7};
+        REQUIRE(compact.size() == tokens.size());
+        for(std::size_t i = 0; i < tokens.size(); ++i) {
+            const auto view = source.view(compact[i]);
+            REQUIRE(compact[i].getFileId() == 7);
+            REQUIRE(view.getKind() == tokens[i].getKind());
+            REQUIRE(view.getText() == tokens[i].getText());
+            REQUIRE(view.getSpan() == tokens[i].getSpan());
+            REQUIRE(source.materialize(compact[i]) == tokens[i]);
+            REQUIRE(view.to_string() == tokens[i].to_string(source.path()));
+            REQUIRE(FORMAT("{}", view) == tokens[i].to_string("compact.vn"));
+        }
+    };
+
+    SECTION("operators, literals and comments over several lines") {
+        check("fun main() {\n  var x: i32 = #xFF + 1.5e3;\n  /* multi\n line */ x += 'a';\n  return \"s\\\"t\";\n}\n");
+    }
+    SECTION("BOM and Unicode line terminators") {
+        check("\xEF\xBB\xBFvar\xC2\x85x\xE2\x80\xA8y\xE2\x80\xA9z\n\xE5\x8F\x98 @");
+    }
+    SECTION("empty source yields only Eof") { check(""); }
+    SECTION("every vn_files sample") {
+        for(const auto &entry : fs::directory_iterator(JSAV_VN_FILES_DIR)) {
+            if(entry.path().extension() == ".vn") { check(vnd::readFromFile(entry.path().string())); }
+        }
+    }
+}
+
+TEST_CASE("CompactToken_SourceFile_LocationCountsEveryTerminator", "[lexer][compact]") {
+    const std::string src = "ab\ncd\xC2\x85" "e\xE2\x80\xA8" "f";
+    const jsv::SourceFile source{src, "loc.vn"};
+    REQUIRE(source.location(0) == jsv::SourceLocation{1, 1, 0});
+    REQUIRE(source.location(4) == jsv::SourceLocation{2, 2, 4});
+    REQUIRE(source.location(7) == jsv::SourceLocation{3, 1, 7});
+    REQUIRE(source.location(11) == jsv::SourceLocation{4, 1, 11});
+    REQUIRE(source.location(src.size() + 10) == source.location(src.size()));
+    const jsv::CompactToken token{jsv::TokenKind::IdentifierAscii, 3, 2};
+    REQUIRE(source.text_of(token) == "cd");
+    REQUIRE(source.text_of(jsv::CompactToken{jsv::TokenKind::IdentifierAscii, 3, 2, 5}).empty());
+    REQUIRE(source.text_of(jsv::CompactToken{jsv::TokenKind::IdentifierAscii, 100, 2}).empty());
+    REQUIRE(source.text_of(jsv::CompactToken{jsv::TokenKind::IdentifierAscii, 12, 1}).empty());
+    REQUIRE(source.span_of(token).file_id == source.id());
+    REQUIRE(source.span_of(token).end == jsv::SourceLocation{2, 3, 5});
+}
+
+// ==========================================================================
+// Line-start index (LineIndex.hpp)
+// ==========================================================================
+
+TEST_CASE("ByteScan_FindLineBreakCandidate_MatchesScalarReference", "[lexer][simd]") {
+    for(const std::string lead : {"\n", "\xC2", "\xE2"}) {
+        for(std::size_t at = 0; at < 70; ++at) {
+            const std::string src = std::string(at, 'c') + lead + std::string(40, 'c');
+            for(std::size_t from = 0; from <= at; from += 7) {
+                CAPTURE(at, from);
+                REQUIRE(jsv::simd::find_line_break_candidate(src, from) == at);
+                REQUIRE(jsv::simd::find_line_break_candidate(src, from) == jsv::simd::detail::find_line_break_candidate_scalar(src, from));
+            }
+        }
+    }
+    SECTION("CJK text has no candidates") {
+        std::string src;
+        for(int i = 0; i < 30; ++i) { src += "\xE4\xB8\xAD"; }
+        REQUIRE(jsv::simd::find_line_break_candidate(src, 0) == src.size());
+    }
+}
+
+TEST_CASE("LineIndex_Resolve_MatchesLinearScan", "[lexer][lines]") {
+    std::string src;
+    const std::array<std::string, 6> pieces{"\n", "\xC2\x85", "\xE2\x80\xA8", "\xE2\x80\xA9", "\xC2\xA0", "\xE2\x80\x83"};
+    for(std::size_t i = 0; i < 300; ++i) {
+        src += std::string(i % 37, 'x');
+        src += pieces[i % pieces.size()];
+    }
+    const auto linear = [&src](const std::size_t offset) {
+        std::size_t line = 1;
+        std::size_t line_start = 0;
+        for(std::size_t i = 0; i < offset;) {
+            if(const auto len = jsv::detail::line_terminator_length(src, i); len != 0 && i + len <= offset) {
+                ++line;
+                i += len;
+                line_start = i;
+            } else {
+                ++i;
+            }
+        }
+        return jsv::SourceLocation{line, offset - line_start + 1, offset};
+    };
+    const jsv::LineIndex index{src};
+    REQUIRE(index.line_count() == 201);
+    REQUIRE(index.text_size() == src.size());
+    std::size_t hint = 0;
+    for(std::size_t offset = 0; offset <= src.size(); ++offset) {
+        CAPTURE(offset);
+        REQUIRE(index.resolve(offset) == linear(offset));
+        REQUIRE(index.resolve(offset, hint) == linear(offset));
+    }
+    SECTION("backward jumps and past-the-end offsets") {
+        REQUIRE(index.resolve(3, hint) == linear(3));
+        REQUIRE(hint + 1 == linear(3).line);
+        REQUIRE(index.resolve(src.size() + 100) == linear(src.size()));
+    }
+    SECTION("empty text is one line") {
+        const jsv::LineIndex empty{""};
+        REQUIRE(empty.line_count() == 1);
+        REQUIRE(empty.resolve(0) == jsv::SourceLocation{1, 1, 0});
+        REQUIRE(jsv::LineIndex{}.resolve(5) == jsv::SourceLocation{1, 1, 0});
+    }
+}
+
+TEST_CASE("LineCursor_Resolve_MatchesLineIndex", "[lexer][lines]") {
+    std::string src;
+    const std::array<std::string, 5> pieces{"\n", "\xC2\x85", "\xE2\x80\xA8", "\xE2\x80\xA9", "\xE2\x80\x83"};
+    for(std::size_t i = 0; i < 200; ++i) {
+        src += std::string(i % 23, 'x');
+        src += pieces[i % pieces.size()];
+    }
+    const jsv::LineIndex index{src};
+    // Every step size lands inside multi-byte terminators at some point.
+    for(const std::size_t step : {1U, 2U, 5U, 64U}) {
+        jsv::LineCursor cursor{src};
+        for(std::size_t offset = 0; offset <= src.size(); offset += step) {
+            CAPTURE(step, offset);
+            REQUIRE(cursor.reaches(offset));
+            REQUIRE(cursor.resolve(offset) == index.resolve(offset));
+            // Asking again, or for an earlier offset on the same line, is fine.
+            REQUIRE(cursor.resolve(offset) == index.resolve(offset));
+        }
+        REQUIRE(cursor.resolve(src.size() + 10) == index.resolve(src.size()));
+        REQUIRE_FALSE(cursor.reaches(0));
+    }
+}
+
+TEST_CASE("Lexer_LineTerminatorsAnywhere_StartNewLines", "[lexer][lines]") {
+    SECTION("inside a string literal") {
+        const std::string src = "\"a\xE2\x80\xA8" "b\" c";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens.size() == 3);
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::StringLiteral);
+        REQUIRE(tokens[0].getSpan().end == jsv::SourceLocation{2, 3, 7});
+        REQUIRE(tokens[1].getSpan().start == jsv::SourceLocation{2, 4, 8});
+    }
+    SECTION("raw newline inside a char literal") {
+        const std::string src = "'\n' x";
+        jsv::Lexer lex{src, "test.jsav"};
+        const auto tokens = lex.tokenize();
+        REQUIRE(tokens[0].getKind() == jsv::TokenKind::CharLiteral);
+        REQUIRE(tokens[1].getSpan().start == jsv::SourceLocation{2, 3, 4});
+    }
+    SECTION("compact tokens resolve to the same spans") {
+        const std::string src = "var a\xC2\x85/* \xE2\x80\xA9 */ b = '\n';\n";
+        jsv::Lexer full{src, "test.jsav"};
+        const auto tokens = full.tokenize();
+        jsv::Lexer compact{src, "test.jsav"};
+        const auto compact_tokens = compact.tokenize_compact();
+        const jsv::SourceFile source{src, "test.jsav"};
+        REQUIRE(compact_tokens.size() == tokens.size());
+        for(std::size_t i = 0; i < tokens.size(); ++i) { REQUIRE(source.materialize(compact_tokens[i]) == tokens[i]); }
+    }
+}
+
+// ==========================================================================
+// Structure-of-arrays token stream (TokenStream.hpp)
+// ==========================================================================
+
+TEST_CASE("TokenStream_TokenizeInto_MatchesCompactTokens", "[lexer][tokenstream]") {
+    const std::string src = "fun main() {\n  var x: i32 = #xFF + 1.5e3; // c\n  return \"s\";\n}\n";
+    jsv::Lexer compact_lexer{src, "stream.vn"};
+    const auto compact = compact_lexer.tokenize_compact(3);
+    jsv::TokenStream stream;
+    jsv::Lexer lexer{src, "stream.vn"};
+    lexer.tokenize_into(stream, 3);
+
+    REQUIRE(stream.size() == compact.size());
+    REQUIRE(stream.file_id() == 3);
+    REQUIRE(stream.kinds().size() == stream.size());
+    REQUIRE(stream.offsets().size() == stream.size());
+    REQUIRE(stream.lengths().size() == stream.size());
+    REQUIRE(std::ranges::equal(stream, compact));
+    REQUIRE(stream.kinds().back() == jsv::TokenKind::Eof);
+
+    SECTION("iterator facade works with range algorithms") {
+        const auto idents = std::ranges::count_if(stream, [](const jsv::CompactToken &t) { return t.getKind() == jsv::TokenKind::IdentifierAscii; });
+        REQUIRE(idents == 1);
+        auto it = stream.begin();
+        it += 3;
+        REQUIRE(*it == compact[3]);
+        REQUIRE(it[2] == compact[5]);
+        REQUIRE(stream.end() - it == static_cast<std::ptrdiff_t>(compact.size() - 3));
+        const jsv::SourceFile source{src, "stream.vn", 3};
+        REQUIRE(source.view(compact[1]).getText() == "main");
+        REQUIRE(source.text_of(stream[1]) == "main");
+        // `stream[1]` is a temporary; the view keeps its own copy.
+        const auto view = source.view(stream[1]);
+        REQUIRE(view.getText() == "main");
+        REQUIRE(view.getToken() == compact[1]);
+    }
+    SECTION("reuse keeps capacity, shrink_to_fit releases it") {
+        const auto capacity = stream.capacity();
+        jsv::Lexer small{"a;", "small.vn"};
+        small.tokenize_into(stream, 4);
+        REQUIRE(stream.size() == 3);
+        REQUIRE(stream.file_id() == 4);
+        REQUIRE(stream[0].getFileId() == 4);
+        REQUIRE(stream.capacity() == capacity);
+        stream.shrink_to_fit();
+        REQUIRE(stream.capacity() < capacity);
+        REQUIRE(stream.size() == 3);
+        stream.clear();
+        REQUIRE(stream.empty());
+    }
+}
+
+TEST_CASE("TokenStream_KindScan_MatchesTokenVector", "[lexer][tokenstream]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 20U);
+    REQUIRE_FALSE(corpus.empty());
+    jsv::Lexer aos_lexer{corpus, "corpus.vn"};
+    const auto tokens = aos_lexer.tokenize();
+    jsv::TokenStream stream;
+    jsv::Lexer soa_lexer{corpus, "corpus.vn"};
+    soa_lexer.tokenize_into(stream);
+    REQUIRE(stream.size() == tokens.size());
+
+    const auto is_brace = [](const jsv::TokenKind kind) { return kind == jsv::TokenKind::OpenBrace; };
+    const auto aos_count = std::ranges::count_if(tokens, is_brace, &jsv::Token::getKind);
+    REQUIRE(std::ranges::count_if(stream.kinds(), is_brace) == aos_count);
+}
+
+// ==========================================================================
+// Lazy token range (Lexer::tokens)
+// ==========================================================================
+
+TEST_CASE("Lexer_TokensRange_MatchesTokenize", "[lexer][range]") {
+    const std::string src = "\xEF\xBB\xBF" "fun main() { var x: i32 = 1 + 2; /* c */ return x; }";
+    jsv::Lexer eager{src, "range.vn"};
+    const auto expected = eager.tokenize();
+
+    SECTION("full iteration yields every token including Eof") {
+        jsv::Lexer lexer{src, "range.vn"};
+        std::vector<jsv::Token> streamed;
+        for(const auto &token : lexer.tokens()) { streamed.push_back(token); }
+        REQUIRE(streamed == expected);
+        REQUIRE(streamed.front().getSpan().start.absolute_pos == 3);
+    }
+    SECTION("composes with std::views and stops lexing early") {
+        jsv::Lexer lexer{src, "range.vn"};
+        const auto is_identifier = [](const jsv::Token &t) { return t.getKind() == jsv::TokenKind::IdentifierAscii; };
+        std::vector<std::string_view> names;
+        for(const auto &token : lexer.tokens() | std::views::filter(is_identifier) | std::views::take(1)) { names.push_back(token.getText()); }
+        REQUIRE(names == std::vector<std::string_view>{"x"});
+        // Only what the pipeline pulled was lexed: take's last increment moved the
+        // filter to the next identifier (`x` in `return x`), and no further.
+        REQUIRE(lexer.next_token().getKind() == jsv::TokenKind::Semicolon);
+    }
+    SECTION("next_token skips the BOM too") {
+        jsv::Lexer lexer{src, "range.vn"};
+        const auto first = lexer.next_token();
+        REQUIRE(first.getKind() == jsv::TokenKind::KeywordFun);
+        REQUIRE(first.getSpan().start.column == 4);
+    }
+    SECTION("an exhausted lexer yields a single Eof") {
+        jsv::Lexer lexer{"", "range.vn"};
+        REQUIRE(std::ranges::distance(lexer.tokens()) == 1);
+        REQUIRE(std::ranges::distance(lexer.tokens()) == 1);
+    }
+}
+
+// ==========================================================================
+// Parallel chunked lexing (Lexer::tokenize_parallel_into)
+// ==========================================================================
+
+TEST_CASE("Lexer_TokenizeParallel_MatchesSequential", "[lexer][parallel]") {
+    const auto check = [](const std::string &src, const std::size_t threads) {
+        CAPTURE(threads);
+        jsv::TokenStream expected;
+        jsv::Lexer sequential{src, "par.vn"};
+        sequential.tokenize_into(expected, 5);
+        jsv::TokenStream actual;
+        jsv::Lexer parallel{src, "par.vn"};
+        parallel.tokenize_parallel_into(actual, {.threads = threads, .min_chunk_bytes = 1, .file_id = 5});
+        REQUIRE(actual.file_id() == 5);
+        REQUIRE(std::ranges::equal(actual, expected));
+    };
+    const auto check_all = [&check](const std::string &src) {
+        CAPTURE(src);
+        for(const std::size_t threads : {1U, 2U, 3U, 7U, 16U, 64U}) { check(src, threads); }
+    };
+
+    SECTION("chunks starting inside block comments") {
+        check_all("a /* one\ntwo\nthree\nfour */ b\nc /*\n*/ d\n/* x\ny */\ne");
+        check_all("/*\n\n\n\n\n\n\n\n\n\n\n\n*/ end");
+        check_all("start /* never\nclosed\nat\nall\n");
+    }
+    SECTION("chunks starting inside literals and after line comments") {
+        check_all("x = \"a\\\nb\\\nc\";\ny = '\n';\nz // \"\n\"q\"\n'\\\n'\n");
+        check_all("\"unterminated\nstring\n\" // */ /*\n*/ 1\n");
+    }
+    SECTION("BOM, Unicode and empty input") {
+        check_all("\xEF\xBB\xBF" "var \xE5\x8F\x98\n\xC2\x85 x\n\xE2\x80\xA8 y\n");
+        check_all("");
+        check_all("\n\n\n");
+    }
+    SECTION("vn_files corpus") {
+        const auto corpus = load_vn_corpus(std::size_t{1} << 16U);
+        for(const std::size_t threads : {2U, 4U, 13U}) { check(corpus, threads); }
+    }
+    SECTION("small inputs fall back to the sequential lexer") {
+        jsv::TokenStream stream;
+        jsv::Lexer lexer{"a b c", "par.vn"};
+        lexer.tokenize_parallel_into(stream, {.threads = 8, .min_chunk_bytes = jsv::ParallelLexOptions{}.min_chunk_bytes, .file_id = std::nullopt});
+        REQUIRE(stream.size() == 4);
+    }
+}
+
+// ==========================================================================
+// Incremental re-lexing (Lexer::relex)
+// ==========================================================================
+
+namespace {
+    jsv::TokenStream lex_stream(const std::string &src) {
+        jsv::TokenStream stream;
+        jsv::Lexer lexer{src, "relex.vn"};
+        lexer.tokenize_into(stream);
+        return stream;
+    }
+
+    // Apply `edit` to `src`, relex the old stream and compare with a full lex.
+    jsv::RelexResult check_relex(const std::string &src, const std::size_t offset, const std::size_t removed, const std::string &inserted) {
+        CAPTURE(src, offset, removed, inserted);
+        auto stream = lex_stream(src);
+        auto edited = src;
+        edited.replace(offset, removed, inserted);
+        const auto result = jsv::Lexer::relex(stream, {.offset = offset, .removed = removed, .inserted = inserted.size()}, edited);
+        REQUIRE(std::ranges::equal(stream, lex_stream(edited)));
+        return result;
+    }
+}  // namespace
+
+TEST_CASE("Lexer_Relex_MatchesFullLex", "[lexer][relex]") {
+    SECTION("a local edit only relexes nearby tokens") {
+        const std::string src = "var a = 1;\nvar b = 2;\nvar c = 3;\nvar d = 4;\n";
+        const auto result = check_relex(src, src.find('2'), 1, "42");
+        REQUIRE(result.inserted == result.removed);
+        REQUIRE(result.inserted <= 4);
+        REQUIRE(result.first > 0);
+    }
+    SECTION("edits that open or close block comments") {
+        const std::string src = "a b /* c d */ e f\ng h";
+        check_relex(src, 2, 0, "/*");
+        check_relex(src, src.find("*/"), 2, "");
+        check_relex(src, src.find("/*"), 2, "");
+        check_relex(src, src.size(), 0, " /* tail");
+    }
+    SECTION("edits that open or close string and char literals") {
+        const std::string src = "x = \"abc\"; y = 'q'; z = 1;\nw = 2;";
+        check_relex(src, 4, 1, "");
+        check_relex(src, 0, 0, "\"");
+        check_relex(src, src.find('\''), 0, "'");
+        check_relex(src, src.find('q'), 1, "\\");
+    }
+    SECTION("edits at the edges and around the BOM") {
+        const std::string src = "\xEF\xBB\xBF" "fun main() {}";
+        check_relex(src, 0, 3, "");
+        check_relex(src, 0, 0, "x");
+        check_relex(src, src.size(), 0, "\n1i32");
+        check_relex("", 0, 0, "a + b");
+        check_relex("a + b", 0, 5, "");
+    }
+    SECTION("edits that extend a token through lookahead") {
+        check_relex("1 e+", 1, 1, "");
+        check_relex("x = 1i3 ;", 7, 0, "2");
+        check_relex("abc def", 3, 0, "_");
+        check_relex("a\xC2" "b", 2, 0, "\x85");
+    }
+    SECTION("random edits on the vn_files corpus") {
+        const auto corpus = load_vn_corpus(std::size_t{1} << 14U);
+        REQUIRE_FALSE(corpus.empty());
+        const std::array<std::string, 8> snippets{"", "/*", "*/", "\"", "'", "\n", "1.5e+", "fun x"};
+        std::mt19937 rng{11};
+        for(int i = 0; i < 200; ++i) {
+            const auto offset = std::uniform_int_distribution<std::size_t>{0, corpus.size()}(rng);
+            const auto removed = std::uniform_int_distribution<std::size_t>{0, std::min<std::size_t>(16, corpus.size() - offset)}(rng);
+            check_relex(corpus, offset, removed, snippets[std::uniform_int_distribution<std::size_t>{0, snippets.size() - 1}(rng)]);
+        }
+    }
+}
+
+TEST_CASE("Lexer_Relex_NonAsciiEditsMatchFullLex", "[lexer][relex][utf8]") {
+    std::string src;
+    for(int i = 0; i < 2'000; ++i) { src += FORMAT("var 变量{} = \"värde {}\"; // ñ\n", i, i); }
+    src += "\x80\n";
+    // A non-ASCII identifier start, and a lead byte that splits a sequence.
+    REQUIRE(check_relex(src, src.find("变量1000"), 0, "é").inserted <= 4);
+    check_relex(src, src.find("värde 500"), 1, "\xC3");
+    check_relex(src, src.find("ñ"), 0, "\xC3");
+}
+
+// ==========================================================================
+// Whole-buffer UTF-8 validation (unicode::validate_utf8)
+// ==========================================================================
+
+TEST_CASE("Utf8_ValidateUtf8_IsBuiltWithTheLibrarySimdPath", "[lexer][utf8][validate][simd]") {
+    // The comparisons against the scalar references only cover the kernels
+    // the library runs if this file is compiled with the same SIMD flags.
+#ifdef JSV_SIMD_AVX2
+    constexpr bool avx2 = true;
+#else
+    constexpr bool avx2 = false;
+#endif
+    const std::string_view simd_type{JSAV_SIMD_INSTRUCTION_TYPE};
+    CAPTURE(simd_type);
+    REQUIRE(avx2 == (simd_type == "AVX2" || simd_type == "AVX512F"));
+}
+
+TEST_CASE("Utf8_ValidateUtf8_MatchesScalarReference", "[lexer][utf8][validate]") {
+    using namespace jsv::unicode;
+    const auto check = [](const std::string &s) {
+        CAPTURE(s.size());
+        const auto res = validate_utf8(s);
+        REQUIRE(res.invalid == detail::validate_utf8_scalar(s).invalid);
+        REQUIRE(res.is_valid() == is_valid_utf8(s));
+    };
+
+    SECTION("sequences around every block boundary") {
+        const std::array<std::string, 10> seqs{"\xC3\xA9", "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xED\xA0\x80", "\xC0\xAF",
+                                               "\xF4\x90\x80\x80", "\xE0\x80\x80", "\x80", "\xFF", "\xC3\xA9\x80"};
+        for(std::size_t len = 0; len < 100; ++len) {
+            for(const auto &seq : seqs) {
+                const std::string pad(len, 'a');
+                check(pad + seq);
+                check(pad + seq + "tail");
+                check(pad + seq.substr(0, seq.size() - 1));
+                check(pad + seq.substr(0, seq.size() - 1) + "tail" + seq + pad);
+            }
+        }
+    }
+    SECTION("random mutations of the vn_files corpus") {
+        const auto corpus = load_vn_corpus(std::size_t{1} << 12U);
+        REQUIRE_FALSE(corpus.empty());
+        check(corpus);
+        std::mt19937 rng{12};
+        for(int i = 0; i < 300; ++i) {
+            auto mutated = corpus;
+            for(int k = 0; k < 1 + i % 4; ++k) {
+                mutated[std::uniform_int_distribution<std::size_t>{0, mutated.size() - 1}(rng)] =
+                    static_cast<char>(std::uniform_int_distribution<int>{0x80, 0xFF}(rng));
+            }
+            check(mutated);
+        }
+    }
+    SECTION("random bytes") {
+        std::mt19937 rng{1212};
+        for(int i = 0; i < 200; ++i) {
+            std::string bytes(std::uniform_int_distribution<std::size_t>{0, 300}(rng), '\0');
+            for(auto &b : bytes) { b = static_cast<char>(std::uniform_int_distribution<int>{0x7E, 0xF5}(rng)); }
+            check(bytes);
+        }
+    }
+}
+
+TEST_CASE("Lexer_Utf8Validation_InvalidRangesKeepCarefulDecode", "[lexer][utf8][validate]") {
+    const std::string src = "\xE5\x8F\x98 \x80 \xE5\x8F\x98 \"\xC3\xA9\" \"\x80\" '\xC3\xA9' '\xC0' \"\\\xC3\xA9\" \xE2\x80\x83x";
+    jsv::Lexer lexer{src, "utf8.vn"};
+    std::vector<jsv::TokenKind> kinds;
+    for(const auto &tok : lexer.tokenize()) { kinds.push_back(tok.getKind()); }
+    using enum jsv::TokenKind;
+    REQUIRE(kinds == std::vector{IdentifierUnicode, Error, IdentifierUnicode, StringLiteral, Error, CharLiteral, Error, Error,
+                                 IdentifierAscii, Eof});
+}
+
+// ==========================================================================
+// Three-stage Unicode property tables (UnicodeData.hpp)
+// ==========================================================================
+
+TEST_CASE("UnicodeData_PropertyTables_MatchRangesForEveryCodepoint", "[lexer][unicode][tables]") {
+    using namespace jsv::unicode;
+    std::size_t mismatches = 0;
+    for(char32_t cp = 0; cp <= 0x10FFFFU; ++cp) {
+        mismatches += static_cast<std::size_t>(letter_table.contains(cp) != detail::in_ranges(cp, letter_ranges));
+        mismatches += static_cast<std::size_t>(id_start_table.contains(cp) != detail::in_ranges(cp, id_start_ranges));
+        mismatches += static_cast<std::size_t>(id_continue_table.contains(cp) != detail::in_ranges(cp, id_continue_ranges));
+        mismatches += static_cast<std::size_t>(whitespace_table.contains(cp) != detail::in_ranges(cp, whitespace_ranges));
+    }
+    REQUIRE(mismatches == 0);
+}
+
+// ==========================================================================
+// Identifier interning (Interner, Lexer::set_interner)
+// ==========================================================================
+
+TEST_CASE("Interner_Intern_AssignsDenseIdsInFirstSeenOrder", "[lexer][interner]") {
+    jsv::Interner interner;
+    REQUIRE(interner.intern("alpha") == 0);
+    REQUIRE(interner.intern("beta") == 1);
+    REQUIRE(interner.intern("alpha") == 0);
+    REQUIRE(interner.intern("") == 2);
+    REQUIRE(interner.find("beta") == 1);
+    REQUIRE(interner.find("gamma") == jsv::no_symbol);
+    REQUIRE(interner.name(1) == "beta");
+    REQUIRE(interner.size() == 3);
+    const auto &stats = interner.stats();
+    REQUIRE(stats.symbols == 3);
+    REQUIRE(stats.lookups == 4);
+    REQUIRE(stats.bytes_seen == 14);
+    REQUIRE(stats.bytes_saved() == 5);
+
+    SECTION("growth keeps ids and arena views stable") {
+        const auto first = interner.name(0);
+        std::vector<std::string> names;
+        for(int i = 0; i < 20'000; ++i) { names.push_back(FORMAT("name_{}", i)); }
+        names.emplace_back(std::size_t{100'000}, 'x');  // larger than an arena block
+        for(std::size_t i = 0; i < names.size(); ++i) { REQUIRE(interner.intern(names[i]) == i + 3); }
+        for(std::size_t i = 0; i < names.size(); ++i) {
+            REQUIRE(interner.find(names[i]) == i + 3);
+            REQUIRE(interner.name(C_UI32T(i + 3)) == names[i]);
+        }
+        REQUIRE(first.data() == interner.name(0).data());
+        REQUIRE(interner.name(0) == "alpha");
+    }
+}
+
+TEST_CASE("Lexer_Interner_TagsIdentifierTokens", "[lexer][interner]") {
+    const std::string src = "var count = count + 1;\nfun \xE5\x8F\x98(x) { return x + count + \xE5\x8F\x98; }\nmain";
+
+    SECTION("identifiers carry their symbol, everything else none") {
+        jsv::Interner interner;
+        jsv::Lexer lexer{src, "intern.vn"};
+        lexer.set_interner(&interner);
+        for(const auto &tok : lexer.tokenize()) {
+            CAPTURE(tok);
+            if(tok.getKind() == jsv::TokenKind::IdentifierAscii || tok.getKind() == jsv::TokenKind::IdentifierUnicode) {
+                REQUIRE(tok.getSymbol() != jsv::no_symbol);
+                REQUIRE(interner.name(tok.getSymbol()) == tok.getText());
+            } else {
+                REQUIRE(tok.getSymbol() == jsv::no_symbol);
+            }
+        }
+        REQUIRE(interner.size() == 3);  // count, 变, x
+        REQUIRE(interner.find("count") == 0);
+        REQUIRE(interner.stats().lookups == 7);
+    }
+    SECTION("no interner, no symbols") {
+        jsv::Lexer lexer{src, "intern.vn"};
+        REQUIRE(std::ranges::all_of(lexer.tokenize(), [](const jsv::Token &tok) { return tok.getSymbol() == jsv::no_symbol; }));
+    }
+    SECTION("every entry point assigns the same ids") {
+        const auto corpus = load_vn_corpus(std::size_t{1} << 16U);
+        jsv::Interner seq_interner;
+        jsv::Lexer sequential{corpus, "corpus.vn"};
+        sequential.set_interner(&seq_interner);
+        jsv::TokenStream expected;
+        sequential.tokenize_into(expected);
+        REQUIRE(seq_interner.size() > 0);
+
+        jsv::Interner par_interner;
+        jsv::Lexer parallel{corpus, "corpus.vn"};
+        parallel.set_interner(&par_interner);
+        jsv::TokenStream actual;
+        parallel.tokenize_parallel_into(actual, {.threads = 4, .min_chunk_bytes = 1, .file_id = std::nullopt});
+        REQUIRE(std::ranges::equal(actual.payloads(), expected.payloads()));
+
+        jsv::Interner compact_interner;
+        jsv::Lexer compact{corpus, "corpus.vn"};
+        compact.set_interner(&compact_interner);
+        REQUIRE(std::ranges::equal(compact.tokenize_compact(), expected));
+
+        // Relex an edit that introduces a new name and reuses an old one.
+        auto edited = corpus;
+        const auto offset = corpus.find('\n') + 1;
+        const std::string inserted = "brand_new_name count ";
+        edited.insert(offset, inserted);
+        jsv::Lexer::relex(expected, {.offset = offset, .inserted = inserted.size()}, edited, {.interner = &seq_interner});
+        jsv::Interner fresh_interner;
+        jsv::Lexer full{edited, "corpus.vn"};
+        full.set_interner(&fresh_interner);
+        jsv::TokenStream relexed_full;
+        full.tokenize_into(relexed_full);
+        REQUIRE(expected.size() == relexed_full.size());
+        for(std::size_t i = 0; i < expected.size(); ++i) {
+            REQUIRE((expected.payloads()[i] == jsv::no_symbol) == (relexed_full.payloads()[i] == jsv::no_symbol));
+            if(expected.payloads()[i] != jsv::no_symbol) {
+                REQUIRE(seq_interner.name(expected.payloads()[i]) == fresh_interner.name(relexed_full.payloads()[i]));
+            }
+        }
+    }
+}
+
+TEST_CASE("Lexer_Interner_StatsOnGeneratedProgram", "[lexer][interner]") {
+    std::string src;
+    for(int i = 0; i < 20'000; ++i) { src += FORMAT("var value_{} = value_{} * factor + offset_{};\n", i % 500, (i + 1) % 500, i % 7); }
+    jsv::Interner interner;
+    jsv::Lexer lexer{src, "generated.vn"};
+    lexer.set_interner(&interner);
+    jsv::TokenStream stream;
+    lexer.tokenize_into(stream);
+    const auto &stats = interner.stats();
+    INFO(FORMAT("{} identifiers, {} unique symbols, {} bytes seen, {} bytes saved", stats.lookups, stats.symbols, stats.bytes_seen,
+                stats.bytes_saved()));
+    REQUIRE(stats.symbols == 508);
+    REQUIRE(stats.lookups == 80'000);
+    REQUIRE(stats.bytes_saved() > stats.bytes_stored);
+}
+
+// ==========================================================================
+// Numeric literal decoding (LiteralTable, Lexer::set_literal_table)
+// ==========================================================================
+
+namespace {
+    jsv::NumericLiteral decode_one(const std::string_view src) {
+        jsv::LiteralTable literals;
+        jsv::Lexer lexer{src, "literal.vn"};
+        lexer.set_literal_table(&literals);
+        const auto tokens = lexer.tokenize();
+        REQUIRE(tokens.size() == 2);
+        REQUIRE(tokens[0].getText() == src);
+        REQUIRE(tokens[0].getLiteral() == 0);
+        REQUIRE(tokens[0].getSymbol() == jsv::no_symbol);
+        REQUIRE(literals.size() == 1);
+        return literals[0];
+    }
+
+    jsv::NumericLiteral integer(const std::uint64_t value, const std::uint8_t base = 10,
+                                const jsv::NumericSuffix suffix = jsv::NumericSuffix::None, const bool overflow = false) {
+        return {.integer = value, .base = base, .suffix = suffix, .overflow = overflow};
+    }
+
+    jsv::NumericLiteral real(const double value, const jsv::NumericSuffix suffix = jsv::NumericSuffix::None, const bool overflow = false) {
+        return {.real = value, .suffix = suffix, .is_float = true, .overflow = overflow};
+    }
+}  // namespace
+
+TEST_CASE("Lexer_LiteralTable_DecodesNumericLiterals", "[lexer][literals]") {
+    using enum jsv::NumericSuffix;
+    SECTION("decimal integers and suffixes") {
+        REQUIRE(decode_one("0") == integer(0));
+        REQUIRE(decode_one("42") == integer(42));
+        REQUIRE(decode_one("255u8") == integer(255, 10, U8));
+        REQUIRE(decode_one("7i16") == integer(7, 10, I16));
+        REQUIRE(decode_one("100000U32") == integer(100000, 10, U32));
+        REQUIRE(decode_one("18446744073709551615") == integer(18446744073709551615ULL));
+        REQUIRE(decode_one("18446744073709551616").overflow);
+        REQUIRE(decode_one("99999999999999999999999").overflow);
+    }
+    SECTION("based integers") {
+        REQUIRE(decode_one("#b1010") == integer(10, 2));
+        REQUIRE(decode_one("#o755") == integer(493, 8));
+        REQUIRE(decode_one("#xDEAD_BEEFu") == integer(0xDEADBEEF, 16, U));
+        REQUIRE(decode_one("#xffff_ffff_ffff_ffff") == integer(0xFFFF'FFFF'FFFF'FFFF, 16));
+        REQUIRE(decode_one("#x1_0000_0000_0000_0000").overflow);
+    }
+    SECTION("decimal floats") {
+        REQUIRE(decode_one("3.14e-2f") == real(3.14e-2, F));
+        REQUIRE(decode_one("123.") == real(123.0));
+        REQUIRE(decode_one(".5") == real(0.5));
+        REQUIRE(decode_one("1e5") == real(1e5));
+        REQUIRE(decode_one("2E+3") == real(2e3));
+        REQUIRE(decode_one("2d") == real(2.0, D));
+        REQUIRE(decode_one("6.02214076e23") == real(6.02214076e23));
+        REQUIRE(decode_one("9007199254740993.0") == real(9007199254740993.0));
+        REQUIRE(decode_one("0.1000000000000000055511151231257827") == real(0.1));
+        REQUIRE(decode_one("1.7976931348623157e308") == real(1.7976931348623157e308));
+        REQUIRE(decode_one("4.9406564584124654e-324") == real(4.9406564584124654e-324));
+        REQUIRE(decode_one("1e400") == real(std::numeric_limits<double>::infinity(), None, true));
+        REQUIRE(decode_one("1e-400") == real(0.0, None, true));
+        REQUIRE(decode_one("0e999999999999") == real(0.0));
+    }
+    SECTION("fast path agrees with from_chars") {
+        std::mt19937_64 rng{15};
+        for(int i = 0; i < 20'000; ++i) {
+            const auto mantissa = rng() >> (11U + rng() % 40U);
+            const auto exponent = static_cast<int>(rng() % 61) - 30;
+            const auto text = FORMAT("{}e{}", mantissa, exponent);
+            double expected = 0;
+            std::from_chars(text.data(), text.data() + text.size(), expected);
+            INFO(text);
+            REQUIRE(decode_one(text).real == expected);
+        }
+    }
+    SECTION("no table, no literal ids") {
+        jsv::Lexer lexer{"1 #x2 3.0", "literal.vn"};
+        REQUIRE(std::ranges::all_of(lexer.tokenize(), [](const jsv::Token &tok) { return tok.getLiteral() == jsv::no_literal; }));
+    }
+}
+
+TEST_CASE("Lexer_LiteralTable_EveryEntryPointDecodesAlike", "[lexer][literals]") {
+    auto corpus = load_vn_corpus(std::size_t{1} << 16U);
+    for(int i = 0; i < 2'000; ++i) {
+        corpus += FORMAT("var n{} = {} + #x{:X}u * {}.{}e-{}f;\n", i, i * 7919, i * 104729, i, i % 97, i % 30);
+    }
+    const auto decoded = [](const jsv::TokenStream &stream, const jsv::LiteralTable &literals) {
+        std::vector<jsv::NumericLiteral> values;
+        for(const auto tok : stream) {
+            if(jsv::isNumericLiteral(tok.getKind())) { values.push_back(literals[tok.getLiteral()]); }
+        }
+        return values;
+    };
+
+    jsv::LiteralTable seq_literals;
+    jsv::Interner seq_interner;
+    jsv::Lexer sequential{corpus, "corpus.vn"};
+    sequential.set_literal_table(&seq_literals);
+    sequential.set_interner(&seq_interner);
+    jsv::TokenStream expected;
+    sequential.tokenize_into(expected);
+    const auto expected_values = decoded(expected, seq_literals);
+    REQUIRE(expected_values.size() == seq_literals.size());
+    REQUIRE(expected_values.size() > 6'000);
+
+    jsv::LiteralTable par_literals;
+    jsv::Interner par_interner;
+    jsv::Lexer parallel{corpus, "corpus.vn"};
+    parallel.set_literal_table(&par_literals);
+    parallel.set_interner(&par_interner);
+    jsv::TokenStream actual;
+    parallel.tokenize_parallel_into(actual, {.threads = 4, .min_chunk_bytes = 1, .file_id = std::nullopt});
+    REQUIRE(std::ranges::equal(actual.payloads(), expected.payloads()));
+    REQUIRE(decoded(actual, par_literals) == expected_values);
+
+    // Relex an edit that changes one literal and adds another.
+    auto edited = corpus;
+    const auto offset = corpus.rfind("= ") + 2;
+    const std::string inserted = "#b11 + 0.25 + ";
+    edited.insert(offset, inserted);
+    jsv::Lexer::relex(expected, {.offset = offset, .inserted = inserted.size()}, edited, {.interner = &seq_interner, .literals = &seq_literals});
+    jsv::LiteralTable fresh_literals;
+    jsv::Lexer full{edited, "corpus.vn"};
+    full.set_literal_table(&fresh_literals);
+    jsv::TokenStream relexed_full;
+    full.tokenize_into(relexed_full);
+    REQUIRE(decoded(expected, seq_literals) == decoded(relexed_full, fresh_literals));
+}
+
+// ==========================================================================
+// String literal decoding (StringTable, Lexer::set_string_table)
+// ==========================================================================
+
+TEST_CASE("Lexer_StringTable_DecodesEscapesOnce", "[lexer][strings]") {
+    const std::string src = R"("plain" "a\tb\n" "é\U0001F600" "bad \q \u12" 'x' '\n' 'λ' "unterminated)"
+                            "\n'\xC3\xA9'";
+    jsv::StringTable strings;
+    jsv::Lexer lexer{src, "strings.vn"};
+    lexer.set_string_table(&strings);
+    const auto tokens = lexer.tokenize();
+    REQUIRE(tokens.size() == 10);
+    REQUIRE(strings.size() == 9);
+    for(std::size_t i = 0; i < 9; ++i) {
+        CAPTURE(tokens[i]);
+        REQUIRE(tokens[i].getString() == i);
+        REQUIRE(tokens[i].getSymbol() == jsv::no_symbol);
+    }
+    const auto &plain = strings[0];
+    REQUIRE(plain.value == "plain");
+    REQUIRE_FALSE(plain.escaped);
+    // Zero copy: the value is the source bytes between the quotes.
+    REQUIRE(plain.value.data() == src.data() + 1);
+
+    REQUIRE(strings[1].value == "a\tb\n");
+    REQUIRE(strings[1].escaped);
+    REQUIRE(strings[1].valid);
+    REQUIRE(strings[2].value == "\xC3\xA9\xF0\x9F\x98\x80");
+    REQUIRE(strings[3].value == R"(bad \q \u12)");
+    REQUIRE_FALSE(strings[3].valid);
+
+    REQUIRE(strings[4].codepoint == U'x');
+    REQUIRE(strings[4].value.data() == tokens[4].getText().data() + 1);
+    REQUIRE(strings[5].codepoint == U'\n');
+    REQUIRE(strings[6].codepoint == U'λ');
+    REQUIRE(strings[6].value == "\xCE\xBB");
+    REQUIRE(strings[7].value == "unterminated");
+    REQUIRE(strings[8].codepoint == U'é');
+    REQUIRE(strings[8].valid);
+
+    SECTION("no table, no string ids") {
+        jsv::Lexer plain_lexer{src, "strings.vn"};
+        REQUIRE(std::ranges::all_of(plain_lexer.tokenize(), [](const jsv::Token &tok) { return tok.getString() == jsv::no_string; }));
+    }
+    SECTION("malformed literals get no entry") {
+        jsv::StringTable error_strings;
+        jsv::Lexer error_lexer{"\"a\xFF\" 'b'", "strings.vn"};
+        error_lexer.set_string_table(&error_strings);
+        const auto error_tokens = error_lexer.tokenize();
+        REQUIRE(error_tokens[0].getKind() == jsv::TokenKind::Error);
+        REQUIRE(error_tokens[1].getString() == 0);
+        REQUIRE(error_strings.size() == 1);
+    }
+}
+
+TEST_CASE("Lexer_StringTable_EscapedLiteralsShareArenaBlocks", "[lexer][strings]") {
+    std::string src;
+    for(int i = 0; i < 20'000; ++i) { src += FORMAT(R"(print("row {}\té\n", "plain {}", '\t');)" "\n", i, i); }
+    jsv::StringTable strings;
+    jsv::Lexer lexer{src, "strings.vn"};
+    lexer.set_string_table(&strings);
+    jsv::TokenStream stream;
+    lexer.tokenize_into(stream);
+    REQUIRE(strings.size() == 60'000);
+    // ~16 decoded bytes per escaped literal: a few 64 KiB blocks for all of them.
+    REQUIRE(strings.arena().block_count() <= 8);
+    REQUIRE(strings[0].value == "row 0\t\xC3\xA9\n");
+    REQUIRE(strings[1].value == "plain 0");
+
+    SECTION("every entry point decodes alike") {
+        const auto values = [&](const jsv::TokenStream &tokens, const jsv::StringTable &table) {
+            std::vector<std::string_view> out;
+            for(const auto tok : tokens) {
+                if(jsv::isTextLiteral(tok.getKind())) { out.push_back(table[tok.getString()].value); }
+            }
+            return out;
+        };
+        jsv::StringTable par_strings;
+        jsv::Lexer parallel{src, "strings.vn"};
+        parallel.set_string_table(&par_strings);
+        jsv::TokenStream actual;
+        parallel.tokenize_parallel_into(actual, {.threads = 4, .min_chunk_bytes = 1, .file_id = std::nullopt});
+        REQUIRE(std::ranges::equal(actual.payloads(), stream.payloads()));
+        REQUIRE(values(actual, par_strings) == values(stream, strings));
+
+        auto edited = src;
+        const std::string inserted = R"("A\x" + )";
+        edited.insert(6, inserted);
+        jsv::Lexer::relex(stream, {.offset = 6, .inserted = inserted.size()}, edited, {.strings = &strings});
+        jsv::StringTable fresh;
+        jsv::Lexer full{edited, "strings.vn"};
+        full.set_string_table(&fresh);
+        jsv::TokenStream relexed_full;
+        full.tokenize_into(relexed_full);
+        REQUIRE(values(stream, strings) == values(relexed_full, fresh));
+        REQUIRE(values(stream, strings)[0] == R"(A\x)");
+    }
+}
+
+// ==========================================================================
+// First-byte dispatch and operator trie (Operators.hpp)
+// ==========================================================================
+
+namespace {
+    // The hand-written switch the trie replaced, kept as the reference.
+    jsv::OperatorMatch switch_operator(const char c0, const char c1) {
+        using enum jsv::TokenKind;
+        const auto two = [&](const char second, const jsv::TokenKind kind) { return c1 == second ? jsv::OperatorMatch{kind, 2} : jsv::OperatorMatch{}; };
+        const auto pick = [](const jsv::OperatorMatch a, const jsv::OperatorMatch b, const jsv::TokenKind single) {
+            if(a.length != 0) { return a; }
+            if(b.length != 0) { return b; }
+            return jsv::OperatorMatch{single, 1};
+        };
+        switch(c0) {
+        case '+': return pick(two('=', PlusEqual), two('+', PlusPlus), Plus);
+        case '-': return pick(two('=', MinusEqual), two('-', MinusMinus), Minus);
+        case '=': return pick(two('=', EqualEqual), {}, Equal);
+        case '!': return pick(two('=', NotEqual), {}, Not);
+        case '<': return pick(two('=', LessEqual), two('<', ShiftLeft), Less);
+        case '>': return pick(two('=', GreaterEqual), two('>', ShiftRight), Greater);
+        case '|': return pick(two('|', OrOr), {}, Or);
+        case '&': return pick(two('&', AndAnd), {}, And);
+        case '%': return pick(two('=', PercentEqual), {}, Percent);
+        case '^': return pick(two('=', XorEqual), {}, Xor);
+        case '*': return {Star, 1};
+        case '/': return {Slash, 1};
+        case ':': return {Colon, 1};
+        case ',': return {Comma, 1};
+        case '.': return {Dot, 1};
+        case ';': return {Semicolon, 1};
+        case '(': return {OpenParen, 1};
+        case ')': return {CloseParen, 1};
+        case '[': return {OpenBracket, 1};
+        case ']': return {CloseBracket, 1};
+        case '{': return {OpenBrace, 1};
+        case '}': return {CloseBrace, 1};
+        default: return {};
+        }
+    }
+}  // namespace
+
+TEST_CASE("Operators_Trie_MatchesSwitchReference", "[lexer][operators]") {
+    for(int a = 0; a < 256; ++a) {
+        for(int b = 0; b < 256; ++b) {
+            const auto c0 = static_cast<char>(a);
+            const auto c1 = static_cast<char>(b);
+            const auto expected = switch_operator(c0, c1);
+            const auto actual = jsv::match_operator(c0, c1);
+            INFO(a << ' ' << b);
+            REQUIRE(actual.kind == expected.kind);
+            REQUIRE(actual.length == expected.length);
+        }
+    }
+    SECTION("the lexer takes the longest match") {
+        jsv::Lexer lexer{"a<<=b>>c||d&&e!==f++--g.5.h", "ops.vn"};
+        std::vector<jsv::TokenKind> kinds;
+        for(const auto &tok : lexer.tokenize()) { kinds.push_back(tok.getKind()); }
+        using enum jsv::TokenKind;
+        REQUIRE(kinds == std::vector{IdentifierAscii, ShiftLeft, Equal, IdentifierAscii, ShiftRight, IdentifierAscii, OrOr, IdentifierAscii,
+                                     AndAnd, IdentifierAscii, NotEqual, Equal, IdentifierAscii, PlusPlus, MinusMinus, IdentifierAscii, Numeric,
+                                     Dot, IdentifierAscii, Eof});
+    }
+}
+
+TEST_CASE("Lexer_OperatorDispatch_Microbenchmark", "[lexer][operators][performance]") {
+    std::string toy;
+    {
+        std::ifstream in{std::string{JSAV_VN_FILES_DIR} + "/large_toy_program.vn", std::ios::binary};
+        toy.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+    }
+    REQUIRE_FALSE(toy.empty());
+    std::string src;
+    while(src.size() < (std::size_t{4} << 20U)) { src += toy; }
+    std::string expressions;
+    for(int i = 0; i < 100'000; ++i) { expressions += FORMAT("x{0} += (a<<{0}) >= b && c != d || !e % f ^ g - -h;\n", i % 10); }
+
+    // Operator bytes only: isolates the trie from the rest of the lexer.
+    std::string ops;
+    for(const char c : expressions) {
+        if(jsv::has_char_class(c, jsv::CharClass::OperatorStart)) { ops += c; }
+    }
+    BENCHMARK("switch operator scan") {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < ops.size(); ++count) { i += switch_operator(ops[i], i + 1 < ops.size() ? ops[i + 1] : '\0').length; }
+        return count;
+    };
+    BENCHMARK("trie operator scan") {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < ops.size(); ++count) { i += jsv::match_operator(ops[i], i + 1 < ops.size() ? ops[i + 1] : '\0').length; }
+        return count;
+    };
+    BENCHMARK("tokenize_into large_toy_program.vn x4 MiB") {
+        jsv::Lexer lexer{src, "toy.vn"};
+        jsv::TokenStream stream;
+        lexer.tokenize_into(stream);
+        return stream.size();
+    };
+    BENCHMARK("tokenize_into operator-dense expressions") {
+        jsv::Lexer lexer{expressions, "expr.vn"};
+        jsv::TokenStream stream;
+        lexer.tokenize_into(stream);
+        return stream.size();
+    };
+}
+
+// ==========================================================================
+// Sentinel-terminated lexing (Lexer over a padded vnd::SourceBuffer)
+// ==========================================================================
+
+namespace {
+    /// Lex `src` from a plain view and from a padded copy; every token must match.
+    void check_sentinel_matches(const std::string &src) {
+        CAPTURE(src);
+        const auto buffer = vnd::SourceBuffer::copy_of(src);
+        jsv::Lexer checked{std::string_view{src}, "diff.vn"};
+        jsv::Lexer sentinel{buffer, "diff.vn"};
+        REQUIRE_FALSE(checked.is_sentinel_terminated());
+        REQUIRE(sentinel.is_sentinel_terminated());
+        const auto expected = checked.tokenize();
+        const auto actual = sentinel.tokenize();
+        REQUIRE(actual.size() == expected.size());
+        for(std::size_t i = 0; i < actual.size(); ++i) {
+            REQUIRE(actual[i].getKind() == expected[i].getKind());
+            REQUIRE(actual[i].getText() == expected[i].getText());
+            REQUIRE(actual[i].getSpan() == expected[i].getSpan());
+        }
+    }
+}  // namespace
+
+TEST_CASE("Lexer_Sentinel_MatchesCheckedModeAtEveryEnd", "[lexer][sentinel]") {
+    // Every prefix of these ends some scanner mid-token, where the checked
+    // mode relies on its bounds checks.
+    const std::array<std::string, 12> samples{"1.5e+10f 2e- 3u16 4i32 5u9 6i",
+                                              "#b1010u #o755 #xDEAD_BEEFu # #q #x",
+                                              "\"a\\\"b\\u00e9\\U0001F600\" \"open",
+                                              "'a' '\\n' '\\u12' '' '\xC3\xA9' '",
+                                              "a//c\nb /* x */ c /* open",
+                                              "x<<=y>>z||w&&!v==u!=t<=s>=r++--q",
+                                              "\xE5\x8F\x98 \xC3 \xE2\x80\x83 \xC2\x85 \x80",
+                                              ".5 .x 1. 1.e5 1..2",
+                                              std::string{"x\0y \"\0\" '\0' 1\0 #x\0", 19},
+                                              "\xEF\xBB\xBF" "fun main() { return 0; }",
+                                              "   \t\r\n\v\f",
+                                              ""};
+    for(const auto &sample : samples) {
+        for(std::size_t len = 0; len <= sample.size(); ++len) { check_sentinel_matches(sample.substr(0, len)); }
+    }
+}
+
+TEST_CASE("Lexer_Sentinel_MatchesCheckedModeOnCorpusAndRandomInput", "[lexer][sentinel]") {
+    const auto corpus = load_vn_corpus(0);
+    REQUIRE_FALSE(corpus.empty());
+    check_sentinel_matches(corpus);
+
+    SECTION("random fragments") {
+        const std::array<std::string_view, 24> fragments{"1", "2.", ".5", "e", "E+", "-", "f", "u8", "i16", "#", "b", "x",
+                                                         "\"", "'", "\\", "u", "/", "*", "\n", " ", "\xC3", "\xA9", "_a", std::string_view{"\0", 1}};
+        std::mt19937 rng{19};
+        for(int i = 0; i < 2000; ++i) {
+            std::string src;
+            const auto count = std::uniform_int_distribution<std::size_t>{0, 24}(rng);
+            for(std::size_t k = 0; k < count; ++k) { src += fragments[std::uniform_int_distribution<std::size_t>{0, fragments.size() - 1}(rng)]; }
+            check_sentinel_matches(src);
+        }
+    }
+}
+
+TEST_CASE("Lexer_Sentinel_CompactParallelAndTablesMatchCheckedMode", "[lexer][sentinel]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 18U);
+    const auto buffer = vnd::SourceBuffer::copy_of(corpus);
+
+    const auto lex = [](jsv::Lexer &lexer, const bool parallel) {
+        jsv::Interner interner;
+        jsv::LiteralTable literals;
+        jsv::StringTable strings;
+        lexer.set_tables({&interner, &literals, &strings});
+        jsv::TokenStream stream;
+        if(parallel) {
+            lexer.tokenize_parallel_into(stream, {.threads = 4, .min_chunk_bytes = 4096, .file_id = 0});
+        } else {
+            lexer.tokenize_into(stream);
+        }
+        return std::tuple{std::vector(stream.kinds().begin(), stream.kinds().end()), std::vector(stream.offsets().begin(), stream.offsets().end()),
+                          std::vector(stream.lengths().begin(), stream.lengths().end()),
+                          std::vector(stream.payloads().begin(), stream.payloads().end())};
+    };
+    for(const bool parallel : {false, true}) {
+        jsv::Lexer checked{std::string_view{corpus}, "corpus.vn"};
+        jsv::Lexer sentinel{buffer, "corpus.vn"};
+        REQUIRE(lex(sentinel, parallel) == lex(checked, parallel));
+    }
+}
+
+// ==========================================================================
+// SourceManager: owned sources addressed by FileId
+// ==========================================================================
+
+TEST_CASE("SourceManager_AddAndLookup", "[lexer][sources]") {
+    jsv::SourceManager sources;
+    const auto a = sources.add("dir/a.vn", std::string_view{"var a = 1;\nvar b = 2;\n"});
+    const auto b = sources.add("dir/b.vn", std::string_view{"fun main() {}\n"});
+    REQUIRE(a != b);
+    REQUIRE(sources.size() == 2);
+    REQUIRE(sources.path(a) == "dir/a.vn");
+    REQUIRE(sources.text(b) == "fun main() {}\n");
+    REQUIRE(sources.file(b).id() == b);
+    REQUIRE(sources.location(a, 13) == jsv::SourceLocation{2u, 3u, 13u});
+
+    const jsv::SourceSpan span{a, {2u, 1u, 11u}, {2u, 4u, 14u}};
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+    REQUIRE(sources.to_string(span) == "dir\\a.vn:line 2:column 1 - line 2:column 4");
+#else
+    REQUIRE(sources.to_string(span) == "dir/a.vn:line 2:column 1 - line 2:column 4");
+#endif
+}
+
+TEST_CASE("SourceManager_DeduplicatesByContent", "[lexer][sources]") {
+    jsv::SourceManager sources;
+    const auto first = sources.add("first.vn", std::string_view{"var x = 1;"});
+    const auto other = sources.add("other.vn", std::string_view{"var x = 2;"});
+    const auto again = sources.add("copy.vn", std::string_view{"var x = 1;"});
+    REQUIRE(again != first);
+    REQUIRE(other != first);
+    REQUIRE(sources.path(again) == "copy.vn");
+    REQUIRE(sources.text(again).data() == sources.text(first).data());
+    REQUIRE(sources.text(other).data() != sources.text(first).data());
+    REQUIRE(sources.size() == 3);
+    REQUIRE(sources.duplicates() == 1);
+
+    // Only the same path with the same bytes is the same source.
+    REQUIRE(sources.add("first.vn", std::string_view{"var x = 1;"}) == first);
+    REQUIRE(sources.size() == 3);
+
+    const std::string infilename = "sourcemanager_dup.vn";
+    createFile(infilename, "var x = 2;");
+    const auto loaded = sources.load(infilename);
+    REQUIRE(loaded != other);
+    REQUIRE(sources.path(loaded) == infilename);
+    REQUIRE(sources.text(loaded).data() == sources.text(other).data());
+    REQUIRE(sources.duplicates() == 2);
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+
+TEST_CASE("SourceManager_ReferencesSurviveLaterAdds", "[lexer][sources]") {
+    jsv::SourceManager sources;
+    const auto id = sources.add("keep.vn", std::string_view{"keep"});
+    const auto &file = sources.file(id);
+    const auto *text = sources.text(id).data();
+    for(int i = 0; i < 1000; ++i) { std::ignore = sources.add(FORMAT("f{}.vn", i), std::string_view{FORMAT("var v{};", i)}); }
+    REQUIRE(&sources.file(id) == &file);
+    REQUIRE(sources.text(id).data() == text);
+    REQUIRE(file.text() == "keep");
+}
+
+TEST_CASE("SourceManager_LoadRejectsMissingFiles", "[lexer][sources]") {
+    jsv::SourceManager sources;
+    REQUIRE_THROWS_AS(sources.load("sourcemanager_missing.vn"), FileReadError);
+    REQUIRE(sources.size() == 0);
+}
+
+TEST_CASE("Lexer_SourceManager_SpansCarryFileIds", "[lexer][sources]") {
+    jsv::SourceManager sources;
+    std::ignore = sources.add("pad.vn", std::string_view{"// padding file\n"});
+    const auto id = sources.add("lib/main.vn", std::string_view{"fun main() {\n  return 0;\n}\n"});
+    jsv::Lexer lexer{sources, id};
+    REQUIRE(lexer.file_id() == id);
+    REQUIRE(lexer.is_sentinel_terminated());
+
+    const auto tokens = lexer.tokenize();
+    for(const auto &token : tokens) { REQUIRE(token.getSpan().file_id == id); }
+    REQUIRE(tokens[5].getKind() == jsv::TokenKind::KeywordReturn);
+#if defined(_WIN32) || defined(__WIN32__) || defined(WIN32)
+    REQUIRE(sources.to_string(tokens[5]) == R"(RETURN("return") lib\main.vn:line 2:column 3 - line 2:column 9)");
+#else
+    REQUIRE(sources.to_string(tokens[5]) == R"(RETURN("return") lib/main.vn:line 2:column 3 - line 2:column 9)");
+#endif
+
+    // Spans outlive the lexer: they hold an id, not a view of its path.
+    std::optional<jsv::SourceSpan> span;
+    {
+        jsv::Lexer scoped{sources, id};
+        span = scoped.next_token().getSpan();
+    }
+    REQUIRE(sources.path(span->file_id) == "lib/main.vn");
+
+    jsv::TokenStream stream;
+    jsv::Lexer streamed{sources, id};
+    streamed.tokenize_into(stream);
+    REQUIRE(stream.file_id() == id);
+    REQUIRE(sources.file(id).span_of(stream[5]) == tokens[5].getSpan());
+}
+
+TEST_CASE("SourceManager_LoadAll", "[lexer][sources]") {
+    const fs::path dir = "sourcemanager_batch";
+    fs::create_directories(dir);
+    const std::vector<std::string> paths{(dir / "a.vn").string(), (dir / "missing.vn").string(), (dir / "b.vn").string(),
+                                         (dir / "a_copy.vn").string()};
+    createFile(paths[0], "var a = 1;");
+    createFile(paths[2], "var b = 2;");
+    createFile(paths[3], "var a = 1;");
+
+    jsv::SourceManager sources;
+    const auto ids = sources.load_all(paths, 2);
+    REQUIRE(ids.size() == 4);
+    REQUIRE(ids[0].has_value());
+    REQUIRE_FALSE(ids[1].has_value());
+    REQUIRE(std::string_view{ids[1].error().what()} == FORMAT("File not found: {}", paths[1]));
+    REQUIRE(sources.path(*ids[2]) == paths[2]);
+    REQUIRE(*ids[3] != *ids[0]);
+    REQUIRE(sources.path(*ids[3]) == paths[3]);
+    REQUIRE(sources.text(*ids[3]).data() == sources.text(*ids[0]).data());
+    REQUIRE(sources.size() == 3);
+    REQUIRE(sources.duplicates() == 1);
+
+    [[maybe_unused]] auto unsed = fs::remove_all(dir);
+}
+
+// ==========================================================================
+// StreamingLexer: windowed lexing of unbounded input
+// ==========================================================================
+
+namespace {
+    /// Tokens of `source` lexed by a StreamingLexer with the given window.
+    std::vector<jsv::StreamToken> stream_lex(const std::string &source, const jsv::StreamLexOptions &options, std::vector<std::string> *texts = nullptr) {
+        std::istringstream input{source};
+        jsv::StreamingLexer lexer{input, "stream.vn", options};
+        std::vector<jsv::StreamToken> tokens;
+        while(true) {
+            const auto token = lexer.next();
+            tokens.push_back(token);
+            if(texts != nullptr) { texts->emplace_back(token.text); }
+            if(token.kind == jsv::TokenKind::Eof) { break; }
+        }
+        return tokens;
+    }
+
+    void require_same_tokens(const std::string &source, const jsv::StreamLexOptions &options) {
+        jsv::Lexer whole{source, "stream.vn"};
+        const auto expected = whole.tokenize_compact();
+        std::vector<std::string> texts;
+        const auto actual = stream_lex(source, options, &texts);
+        REQUIRE(actual.size() == expected.size());
+        for(std::size_t i = 0; i < expected.size(); ++i) {
+            CAPTURE(i, options.window_bytes, expected[i].getOffset());
+            REQUIRE(actual[i].kind == expected[i].getKind());
+            REQUIRE(actual[i].offset == expected[i].getOffset());
+            REQUIRE(actual[i].length == expected[i].getLength());
+            REQUIRE(texts[i] == source.substr(expected[i].getOffset(), expected[i].getLength()));
+        }
+    }
+}  // namespace
+
+TEST_CASE("StreamingLexer_MatchesWholeInputAtEveryWindowSize", "[lexer][stream]") {
+    const std::string source = "\xEF\xBB\xBF"
+                               "fun main() { /* block\n comment */ var x = 1.5e+10f32; // line\n"
+                               "  var \xCE\xBB\xCE\xB1 = \"str\\\"ing\" + 'c' + #xDEAD_BEEFu + 123. + .456;\xE2\x80\x83"
+                               "x <<= y >= z != w && v || u; /*/ still comment */ /**/ 1i32 0u8 'unterminated\n"
+                               "\"open string\n\xC2\x85 \xF0\x9F\x98\x80 @ $ /* open comment at end";
+    for(const std::size_t window : {1U, 2U, 3U, 5U, 7U, 13U, 16U, 31U, 64U, 4096U}) {
+        require_same_tokens(source, {.window_bytes = window, .max_token_bytes = 64});
+    }
+    require_same_tokens("", {.window_bytes = 4, .max_token_bytes = 4});
+    require_same_tokens("\xEF\xBB", {.window_bytes = 1, .max_token_bytes = 4});
+}
+
+TEST_CASE("StreamingLexer_MatchesWholeInputOnTheCorpus", "[lexer][stream]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 18U);
+    for(const std::size_t window : {97U, 4096U, 65536U}) { require_same_tokens(corpus, {.window_bytes = window, .max_token_bytes = 4096}); }
+}
+
+TEST_CASE("StreamingLexer_LongCommentsCostNoMemory", "[lexer][stream]") {
+    const std::string body(std::size_t{1} << 20U, 'c');
+    const std::string source = "a /*" + body + "*/ b //" + body + "\nc";
+    const auto tokens = stream_lex(source, {.window_bytes = 1024, .max_token_bytes = 64});
+    REQUIRE(tokens.size() == 4);
+    REQUIRE(tokens[1].offset == body.size() + 7);  // `b`, after "a /*" and "*/ "
+    REQUIRE(tokens[2].offset == source.size() - 1);
+    REQUIRE(tokens[3].offset == source.size());
+
+    std::istringstream input{source};
+    jsv::StreamingLexer lexer{input, "stream.vn", {.window_bytes = 1024, .max_token_bytes = 64}};
+    REQUIRE(lexer.buffer_capacity() < 2048);
+    while(lexer.next().kind != jsv::TokenKind::Eof) {}
+    REQUIRE(lexer.bytes_read() == source.size());
+}
+
+TEST_CASE("StreamingLexer_RejectsTokensLongerThanTheLimit", "[lexer][stream]") {
+    const std::string source = "var " + std::string(200, 'x') + " = 1;";
+    REQUIRE_THROWS_AS(stream_lex(source, {.window_bytes = 64, .max_token_bytes = 100}), std::length_error);
+    REQUIRE(stream_lex(source, {.window_bytes = 64, .max_token_bytes = 200})[1].length == 200);
+}
+
+TEST_CASE("StreamingLexer_FillsInternerAndLiteralTable", "[lexer][stream]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 16U);
+    jsv::Interner whole_names;
+    jsv::LiteralTable whole_literals;
+    jsv::Lexer whole{corpus, "stream.vn"};
+    whole.set_interner(&whole_names);
+    whole.set_literal_table(&whole_literals);
+    const auto expected = whole.tokenize_compact();
+
+    jsv::Interner names;
+    jsv::LiteralTable literals;
+    std::istringstream input{corpus};
+    jsv::StreamingLexer lexer{input, "stream.vn", {.window_bytes = 333, .max_token_bytes = 128}};
+    lexer.set_interner(&names);
+    lexer.set_literal_table(&literals);
+    for(const auto &token : expected) {
+        const auto actual = lexer.next();
+        REQUIRE(actual.kind == token.getKind());
+        REQUIRE(actual.payload == token.getPayload());
+    }
+    REQUIRE(names.size() == whole_names.size());
+    REQUIRE(literals.size() == whole_literals.size());
+}
+
+#ifndef _WIN32
+TEST_CASE("StreamingLexer_ReadsAFileDescriptor", "[lexer][stream][file]") {
+    const std::string infilename = "streaming_fd.vn";
+    const std::string source = "fun f() { return 42; }\n";
+    createFile(infilename, source);
+    // NOLINTNEXTLINE(*-vararg)
+    const int fd = ::open(infilename.c_str(), O_RDONLY);
+    REQUIRE(fd >= 0);
+    {
+        jsv::StreamingLexer lexer{fd, infilename, {.window_bytes = 8, .max_token_bytes = 8}};
+        std::vector<jsv::TokenKind> kinds;
+        for(auto token = lexer.next(); token.kind != jsv::TokenKind::Eof; token = lexer.next()) { kinds.push_back(token.kind); }
+        REQUIRE(kinds.size() == 9);
+        REQUIRE(kinds[6] == jsv::TokenKind::Numeric);
+    }
+    ::close(fd);
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+#endif
+
+// ==========================================================================
+// ReadAhead: pipelined reading
+// ==========================================================================
+
+namespace {
+    /// Source over `text` that hands out at most `step` bytes per call.
+    vnd::ReadAhead::Source string_source(const std::string &text, const std::size_t step) {
+        return [&text, step, pos = std::size_t{0}](char *buffer, const std::size_t size) mutable {
+            const auto count = std::min({size, step, text.size() - pos});
+            std::memcpy(buffer, text.data() + pos, count);
+            pos += count;
+            return count;
+        };
+    }
+}  // namespace
+
+TEST_CASE("vnd::ReadAhead - delivers the input in order, one chunk at a time", "[file]") {
+    std::string text;
+    for(int i = 0; i < 20000; ++i) { text += FORMAT("{},", i); }
+    for(const std::size_t chunk : {1U, 7U, 4096U, 1U << 20U}) {
+        vnd::ReadAhead ahead{string_source(text, 1000), chunk, 3};
+        std::string out;
+        std::array<char, 5000> buffer{};
+        while(const auto got = ahead.read(buffer.data(), buffer.size())) {
+            REQUIRE(got <= chunk);
+            out.append(buffer.data(), got);
+        }
+        REQUIRE(out == text);
+        REQUIRE(ahead.consumed() == text.size());
+        REQUIRE(ahead.read(buffer.data(), buffer.size()) == 0);
+    }
+}
+
+TEST_CASE("vnd::ReadAhead - source errors surface after the data read before them", "[file]") {
+    const std::string text(100, 'x');
+    auto inner = string_source(text, 100);
+    vnd::ReadAhead ahead{[&inner](char *buffer, const std::size_t size) -> std::size_t {
+                             if(const auto got = inner(buffer, size); got != 0) { return got; }
+                             throw FILEREADEREERRORF("Unable to read file: {}. Reason: {}", "net.vn", "timed out");
+                         },
+                         10, 2};
+    std::array<char, 64> buffer{};
+    std::size_t total = 0;
+    REQUIRE_THROWS_MATCHES(
+        [&] {
+            while(true) { total += ahead.read(buffer.data(), buffer.size()); }
+        }(),
+        FileReadError, Catch::Matchers::Message("Unable to read file: net.vn. Reason: timed out"));
+    REQUIRE(total == text.size());
+}
+
+TEST_CASE("vnd::ReadAhead - stops reading when destroyed early", "[file]") {
+    std::atomic<std::size_t> calls{0};
+    {
+        vnd::ReadAhead ahead{[&calls](char *buffer, const std::size_t size) {
+                                 ++calls;
+                                 std::memset(buffer, 'a', size);
+                                 return size;
+                             },
+                             16, 2};
+        std::array<char, 4> buffer{};
+        REQUIRE(ahead.read(buffer.data(), buffer.size()) == 4);
+    }
+    // Endless source: only the ring (and one chunk in progress) was ever read.
+    REQUIRE(calls.load() <= 3);
+}
+
+TEST_CASE("vnd::ReadAhead - from_file", "[file]") {
+    REQUIRE_THROWS_MATCHES(vnd::ReadAhead::from_file("nonexistent.txt"), std::runtime_error, MSG_FORMAT("File not found: {}", "nonexistent.txt"));
+
+    const std::string infilename = "readahead.vn";
+    const auto corpus = load_vn_corpus(std::size_t{1} << 17U);
+    createFile(infilename, corpus);
+    const auto ahead = vnd::ReadAhead::from_file(infilename, 4096, 2);
+    jsv::StreamingLexer lexer{[&ahead](char *buffer, const std::size_t size) { return ahead->read(buffer, size); }, infilename,
+                              {.window_bytes = 4096, .max_token_bytes = 1024}};
+    jsv::Lexer whole{corpus, infilename};
+    for(const auto &expected : whole.tokenize_compact()) {
+        const auto token = lexer.next();
+        REQUIRE(token.kind == expected.getKind());
+        REQUIRE(token.offset == expected.getOffset());
+    }
+    REQUIRE(ahead->consumed() == corpus.size());
+    [[maybe_unused]] auto unsed = fs::remove(infilename);
+}
+
+TEST_CASE("StreamingLexer_LexesShortReadsAsTheyArrive", "[lexer][stream]") {
+    const auto corpus = load_vn_corpus(std::size_t{1} << 15U);
+    jsv::Lexer whole{corpus, "stream.vn"};
+    const auto expected = whole.tokenize_compact();
+    for(const std::size_t step : {1U, 3U, 100U}) {
+        jsv::StreamingLexer lexer{string_source(corpus, step), "stream.vn", {.window_bytes = 512, .max_token_bytes = 128}};
+        // The first token is lexed as soon as it and its lookahead have arrived.
+        REQUIRE(lexer.next().kind == expected[0].getKind());
+        REQUIRE(lexer.bytes_read() <= expected[0].getOffset() + expected[0].getLength() + 8 + step);
+        for(std::size_t i = 1; i < expected.size(); ++i) {
+            const auto token = lexer.next();
+            REQUIRE(token.kind == expected[i].getKind());
+            REQUIRE(token.offset == expected[i].getOffset());
+            REQUIRE(token.length == expected[i].getLength());
+        }
+    }
+}
+
+TEST_CASE("StreamingLexer_SkipsBomSplitAcrossShortReads", "[lexer][stream]") {
+    const std::string source = "\xEF\xBB\xBFvar x = 1;";
+    for(const std::size_t step : {1U, 2U, 3U}) {
+        jsv::StreamingLexer lexer{string_source(source, step), "stream.vn"};
+        const auto token = lexer.next();
+        REQUIRE(token.kind == jsv::TokenKind::KeywordVar);
+        REQUIRE(token.offset == 3);
+    }
+}
+
+// ==========================================================================
+// Driver: multi-file inputs on a work-stealing pool
+// ==========================================================================
+
+TEST_CASE("WorkStealingPool_RunsEveryTaskIncludingNestedSubmits", "[driver][pool]") {
+    jsv::WorkStealingPool pool{4};
+    REQUIRE(pool.size() == 4);
+    std::atomic<std::size_t> outer{0};
+    std::atomic<std::size_t> inner{0};
+    for(std::size_t i = 0; i < 200; ++i) {
+        pool.submit([&] {
+            ++outer;
+            pool.submit([&] { ++inner; });
+        });
+    }
+    pool.wait();
+    REQUIRE(outer == 200);
+    REQUIRE(inner == 200);
+
+    // Reusable after a wait.
+    pool.submit([&] { ++outer; });
+    pool.wait();
+    REQUIRE(outer == 201);
+}
+
+TEST_CASE("WorkStealingPool_WaitRethrowsTaskException", "[driver][pool]") {
+    jsv::WorkStealingPool pool{2};
+    std::atomic<std::size_t> ran{0};
+    pool.submit([] { throw std::runtime_error("task failed"); });
+    for(std::size_t i = 0; i < 10; ++i) {
+        pool.submit([&] { ++ran; });
+    }
+    REQUIRE_THROWS_WITH(pool.wait(), "task failed");
+    REQUIRE(ran == 10);
+    // The error is reported once.
+    REQUIRE_NOTHROW(pool.wait());
+}
+
+TEST_CASE("WorkStealingPool_FifoTasksStartInSubmissionOrder", "[driver][pool]") {
+    jsv::WorkStealingPool pool{1};
+    std::mutex mutex;
+    std::vector<std::string> order;
+    const auto record = [&](std::string name) {
+        const std::scoped_lock lock{mutex};
+        order.push_back(vnd_move(name));
+    };
+    // The single worker is held until every outside task is queued.
+    std::promise<void> release;
+    pool.submit([&, released = release.get_future().share()] {
+        released.wait();
+        record("a");
+        pool.submit_fifo([&] { record("fifo"); });
+        pool.submit([&] { record("nested"); });
+    });
+    for(const auto *name : {"b", "c"}) {
+        pool.submit([&, name] { record(name); });
+    }
+    release.set_value();
+    pool.wait();
+    // A nested task runs next; FIFO tasks run oldest first.
+    REQUIRE(order == std::vector<std::string>{"a", "nested", "b", "c", "fifo"});
+}
+
+namespace {
+    /// A small source tree under `root`: two `.vn` files at the top, two
+    /// nested, and one file of another type.
+    void make_driver_tree(const fs::path &root) {
+        fs::remove_all(root);
+        fs::create_directories(root / "sub" / "deep");
+        createFile((root / "b.vn").string(), "var b = 2;");
+        createFile((root / "a.vn").string(), "var a = 1;");
+        createFile((root / "notes.txt").string(), "not a source");
+        createFile((root / "sub" / "c.vn").string(), "var c = a + b;");
+        createFile((root / "sub" / "deep" / "d.vn").string(), "fun d() {}");
+    }
+
+    std::vector<std::string> generic_paths(const std::vector<std::string> &paths) {
+        std::vector<std::string> out;
+        for(const auto &path : paths) { out.push_back(fs::path(path).generic_string()); }
+        return out;
+    }
+}  // namespace
+
+TEST_CASE("CollectInputs_ExpandsDirectoriesAndGlobs", "[driver][inputs]") {
+    const fs::path root = "driver_inputs";
+    make_driver_tree(root);
+    const auto r = root.generic_string();
+
+    SECTION("a directory stands for its source files, recursively and sorted") {
+        const std::vector<std::string> inputs{root.string()};
+        const auto collected = jsv::collect_inputs(inputs);
+        REQUIRE(collected.errors.empty());
+        REQUIRE(generic_paths(collected.files) ==
+                std::vector<std::string>{r + "/a.vn", r + "/b.vn", r + "/sub/c.vn", r + "/sub/deep/d.vn"});
+    }
+    SECTION("globs match one directory, or any depth with **") {
+        const std::vector<std::string> top{(root / "*.vn").string()};
+        REQUIRE(generic_paths(jsv::collect_inputs(top).files) == std::vector<std::string>{r + "/a.vn", r + "/b.vn"});
+        const std::vector<std::string> nested{(root / "**" / "*.vn").string()};
+        REQUIRE(generic_paths(jsv::collect_inputs(nested).files) ==
+                std::vector<std::string>{r + "/a.vn", r + "/b.vn", r + "/sub/c.vn", r + "/sub/deep/d.vn"});
+        const std::vector<std::string> classes{(root / "s?b" / "[a-c].vn").string()};
+        REQUIRE(generic_paths(jsv::collect_inputs(classes).files) == std::vector<std::string>{r + "/sub/c.vn"});
+    }
+    SECTION("an existing path with glob characters names itself") {
+        createFile((root / "case[1].vn").string(), "var e = 1;");
+        const std::vector<std::string> inputs{(root / "case[1].vn").string()};
+        const auto collected = jsv::collect_inputs(inputs);
+        REQUIRE(collected.errors.empty());
+        REQUIRE(generic_paths(collected.files) == std::vector<std::string>{r + "/case[1].vn"});
+        REQUIRE_FALSE(jsv::is_glob_input(inputs.front()));
+        REQUIRE(jsv::is_glob_input((root / "case[2].vn").string()));
+    }
+    SECTION("a file named twice is kept once, in first position") {
+        const std::vector<std::string> inputs{(root / "b.vn").string(), root.string()};
+        REQUIRE(generic_paths(jsv::collect_inputs(inputs).files) ==
+                std::vector<std::string>{r + "/b.vn", r + "/a.vn", r + "/sub/c.vn", r + "/sub/deep/d.vn"});
+    }
+    SECTION("empty matches are errors, missing files are passed through") {
+        const std::vector<std::string> inputs{(root / "*.none").string(), (root / "missing.vn").string()};
+        const auto collected = jsv::collect_inputs(inputs);
+        REQUIRE(collected.errors.size() == 1);
+        REQUIRE_THAT(collected.errors.front(), ContainsSubstring("No files match"));
+        REQUIRE(collected.files == std::vector<std::string>{(root / "missing.vn").string()});
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+TEST_CASE("Driver_DeliversReportsWhileTheRunProgresses", "[driver]") {
+    const fs::path root = "driver_streaming";
+    make_driver_tree(root);
+    const std::vector<std::string> inputs{root.string()};
+    const auto files = jsv::collect_inputs(inputs).files;
+    REQUIRE(files.size() == 4);
+
+    // With one job the first report arrives before the last file is read:
+    // deleting it then makes that file's read fail.
+    jsv::Driver driver{1};
+    std::vector<jsv::FileReport> reports;
+    const auto summary = driver.run(files, [&](const jsv::FileReport &report) {
+        if(reports.empty()) { fs::remove(files.back()); }
+        reports.push_back(report);
+    });
+    REQUIRE(reports.size() == files.size());
+    REQUIRE_FALSE(reports.front().failed);
+    REQUIRE(reports.back().failed);
+    REQUIRE(summary.failed == 1);
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+TEST_CASE("Driver_StartsFilesOnlyWithinTheWindow", "[driver]") {
+    const fs::path root = "driver_window";
+    fs::remove_all(root);
+    fs::create_directories(root);
+    std::vector<std::string> files;
+    for(int i = 0; i < 12; ++i) {
+        files.push_back((root / FORMAT("f{:02}.vn", i)).string());
+        createFile(files.back(), FORMAT("var v{} = {};", i, i));
+    }
+
+    // With one job, the files past the window are not read before the first
+    // report is delivered: deleting them then makes their reads fail.
+    jsv::Driver driver{1};
+    REQUIRE(driver.window() == jsv::Driver::files_per_job);
+    std::vector<jsv::FileReport> reports;
+    [[maybe_unused]] const auto summary = driver.run(files, [&](const jsv::FileReport &report) {
+        if(reports.empty()) {
+            for(std::size_t i = driver.window(); i < files.size(); ++i) { fs::remove(files[i]); }
+        }
+        reports.push_back(report);
+    });
+    REQUIRE(reports.size() == files.size());
+    for(std::size_t i = 0; i < files.size(); ++i) {
+        CAPTURE(i);
+        REQUIRE(reports[i].path == files[i]);
+        REQUIRE(reports[i].failed == (i >= driver.window()));
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+TEST_CASE("Driver_StopsAtTheFirstCallbackException", "[driver]") {
+    const fs::path root = "driver_throw";
+    fs::remove_all(root);
+    fs::create_directories(root);
+    std::vector<std::string> files;
+    for(int i = 0; i < 12; ++i) {
+        files.push_back((root / FORMAT("f{:02}.vn", i)).string());
+        createFile(files.back(), FORMAT("var v{} = {};", i, i));
+    }
+
+    // The failing report is not delivered again, and nothing follows it.
+    for(const std::size_t jobs : {1U, 4U}) {
+        jsv::Driver driver{jobs};
+        std::vector<std::string> delivered;
+        REQUIRE_THROWS_WITH(driver.run(files,
+                                       [&](const jsv::FileReport &report) {
+                                           delivered.push_back(report.path);
+                                           if(delivered.size() == 2) { throw std::runtime_error("write failed"); }
+                                       }),
+                            "write failed");
+        REQUIRE(delivered == std::vector<std::string>{files[0], files[1]});
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+TEST_CASE("Driver_KeepTokens_HandsTokensToTheCallback", "[driver]") {
+    const fs::path root = "driver_tokens";
+    make_driver_tree(root);
+    const std::vector<std::string> inputs{root.string()};
+    const auto files = jsv::collect_inputs(inputs).files;
+
+    for(const bool keep : {false, true}) {
+        jsv::Driver driver{2, keep};
+        REQUIRE(driver.keep_tokens() == keep);
+        std::size_t seen = 0;
+        [[maybe_unused]] const auto summary = driver.run(files, [&](const jsv::FileReport &report) {
+            ++seen;
+            if(!keep) {
+                REQUIRE_FALSE(report.source);
+                REQUIRE(report.stream.empty());
+                return;
+            }
+            REQUIRE(report.source);
+            const auto expected = lex_stream(std::string{report.source->text()});
+            REQUIRE(report.stream.size() == report.tokens);
+            REQUIRE(std::ranges::equal(report.stream.kinds(), expected.kinds()));
+            REQUIRE(std::ranges::equal(report.stream.offsets(), expected.offsets()));
+        });
+        REQUIRE(seen == files.size());
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+TEST_CASE("Driver_ReportsInInputOrderWithTotals", "[driver]") {
+    const fs::path root = "driver_run";
+    make_driver_tree(root);
+    createFile((root / "bad.vn").string(), "var ok = 1;\nvar x = \x80;");
+    const std::vector<std::string> inputs{root.string(), (root / "missing.vn").string()};
+    const auto files = jsv::collect_inputs(inputs).files;
+    REQUIRE(files.size() == 6);
+
+    // Expected totals, lexed one file at a time.
+    std::size_t bytes = 0;
+    std::size_t tokens = 0;
+    for(const auto &file : files) {
+        if(!fs::exists(file)) { continue; }
+        const auto buffer = vnd::SourceBuffer::from_file(file);
+        jsv::Lexer lexer{buffer, file};
+        bytes += buffer.size();
+        tokens += lexer.tokenize().size();
+    }
+
+    for(const std::size_t jobs : {1U, 4U}) {
+        jsv::Driver driver{jobs};
+        REQUIRE(driver.jobs() == jobs);
+        std::vector<jsv::FileReport> reports;
+        const auto summary = driver.run(files, [&](const jsv::FileReport &report) { reports.push_back(report); });
+
+        REQUIRE(reports.size() == files.size());
+        for(std::size_t i = 0; i < files.size(); ++i) { REQUIRE(reports[i].path == files[i]); }
+        REQUIRE(summary.files == files.size());
+        REQUIRE(summary.bytes == bytes);
+        REQUIRE(summary.tokens == tokens);
+        REQUIRE(summary.failed == 1);
+        REQUIRE(summary.diagnostics == 2);
+        REQUIRE(summary.wall.count() > 0);
+
+        const auto &missing = reports.back();
+        REQUIRE(missing.failed);
+        REQUIRE(missing.diagnostics == std::vector<std::string>{FORMAT("error: File not found: {}", files.back())});
+        const auto bad = std::ranges::find_if(reports, [](const auto &report) { return report.path.ends_with("bad.vn"); });
+        REQUIRE(bad != reports.end());
+        REQUIRE_FALSE(bad->failed);
+        REQUIRE(bad->diagnostics.size() == 1);
+        REQUIRE(bad->diagnostics.front().starts_with(FORMAT("{}:2:9: error: unexpected '", bad->path)));
+    }
+
+    [[maybe_unused]] auto unsed = fs::remove_all(root);
+}
+
+// ==========================================================================
+// TokenWriter: buffered token dumps
+// ==========================================================================
+
+namespace {
+    /// Everything `dump` writes for the tokens of `source`, read back.
+    std::string dump_tokens(const std::string &source, const jsv::TokenFormat format, const std::string &path = "dump/main.vn") {
+        const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::tmpfile(), &std::fclose};
+        REQUIRE(file != nullptr);
+        jsv::Lexer lexer{source, path};
+        jsv::TokenStream tokens;
+        lexer.tokenize_into(tokens);
+        {
+            jsv::TokenWriter writer{file.get(), format};
+            writer.set_file(path);
+            writer.write(tokens, source);
+            writer.flush();
+        }
+        std::rewind(file.get());
+        std::string out;
+        std::array<char, 4096> chunk{};
+        for(std::size_t got = 0; (got = std::fread(chunk.data(), 1, chunk.size(), file.get())) != 0;) { out.append(chunk.data(), got); }
+        return out;
+    }
+}  // namespace
+
+TEST_CASE("TokenWriter_ParsesFormatNames", "[driver][dump]") {
+    REQUIRE(jsv::parseTokenFormat("text") == jsv::TokenFormat::Text);
+    REQUIRE(jsv::parseTokenFormat("jsonl") == jsv::TokenFormat::Jsonl);
+    REQUIRE(jsv::parseTokenFormat("binary") == jsv::TokenFormat::Binary);
+    REQUIRE_FALSE(jsv::parseTokenFormat("json").has_value());
+}
+
+TEST_CASE("TokenWriter_Text_OneLinePerTokenWithLocation", "[driver][dump]") {
+    const auto out = dump_tokens("var a\n  = \"q\\\"x\";", jsv::TokenFormat::Text);
+    const auto path = jsv::truncate_path(fs::path{"dump/main.vn"}, 2);
+    REQUIRE(out == FORMAT("{0}(\"var\") {5}:1:1\n"
+                          "{1}(\"a\") {5}:1:5\n"
+                          "{2}(\"=\") {5}:2:3\n"
+                          "{3}(\"\\\"q\\\\\\\"x\\\"\") {5}:2:5\n"
+                          "{6}(\";\") {5}:2:11\n"
+                          "{4}(\"\") {5}:2:12\n",
+                          jsv::tokenKindToString(jsv::TokenKind::KeywordVar), jsv::tokenKindToString(jsv::TokenKind::IdentifierAscii),
+                          jsv::tokenKindToString(jsv::TokenKind::Equal), jsv::tokenKindToString(jsv::TokenKind::StringLiteral),
+                          jsv::tokenKindToString(jsv::TokenKind::Eof), path,
+                          jsv::tokenKindToString(jsv::TokenKind::Semicolon)));
+}
+
+TEST_CASE("TokenWriter_Jsonl_EscapesInvalidUtf8", "[driver][dump]") {
+    const auto out = dump_tokens("é \x80", jsv::TokenFormat::Jsonl, "dir/\"q\".vn");
+    std::vector<std::string> lines;
+    for(const auto line : out | std::views::split('\n')) { lines.emplace_back(line.begin(), line.end()); }
+    REQUIRE(lines.size() == 4);  // Three tokens and the final newline.
+    REQUIRE(lines[0] == FORMAT(R"({{"file":"dir/\"q\".vn","kind":"{}","text":"é","offset":0,"length":2,"line":1,"column":1}})",
+                               jsv::tokenKindToString(jsv::TokenKind::IdentifierUnicode)));
+    REQUIRE(lines[1] == FORMAT(R"({{"file":"dir/\"q\".vn","kind":"{}","text":"\u0080","offset":3,"length":1,"line":1,"column":4}})",
+                               jsv::tokenKindToString(jsv::TokenKind::Error)));
+    REQUIRE(lines[3].empty());
+}
+
+TEST_CASE("TokenWriter_Binary_FixedSizeRecords", "[driver][dump]") {
+    const std::array<std::pair<std::string, std::string>, 2> files{{{"dump/main.vn", "var answer = 42;"}, {"dump/b.vn", "x"}}};
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::tmpfile(), &std::fclose};
+    REQUIRE(file != nullptr);
+    std::vector<jsv::TokenStream> streams(files.size());
+    {
+        jsv::TokenWriter writer{file.get(), jsv::TokenFormat::Binary};
+        for(std::size_t f = 0; f < files.size(); ++f) {
+            jsv::Lexer lexer{files[f].second, files[f].first};
+            lexer.tokenize_into(streams[f]);
+            writer.set_file(files[f].first);
+            writer.write(streams[f], files[f].second);
+        }
+        writer.flush();
+    }
+    std::rewind(file.get());
+    std::string out;
+    std::array<char, 4096> chunk{};
+    for(std::size_t got = 0; (got = std::fread(chunk.data(), 1, chunk.size(), file.get())) != 0;) { out.append(chunk.data(), got); }
+
+    REQUIRE(out.starts_with(jsv::TokenWriter::binary_magic));
+    const std::string_view records = std::string_view{out}.substr(jsv::TokenWriter::binary_magic.size());
+    const auto field = [&](const std::size_t at, const std::size_t bytes) {
+        std::uint64_t value = 0;
+        for(std::size_t i = bytes; i-- > 0;) { value = (value << 8U) | C_UC(records[at + i]); }
+        return value;
+    };
+    std::size_t at = 0;
+    for(std::size_t f = 0; f < files.size(); ++f) {
+        CAPTURE(f);
+        // Each file starts with its header record: marker, path length, path.
+        const auto &[path, source] = files[f];
+        REQUIRE(C_UC(records[at]) == jsv::TokenWriter::binary_file_kind);
+        REQUIRE(field(at + 1, 4) == path.size());
+        REQUIRE(records.substr(at + 5, path.size()) == path);
+        at += 5 + path.size();
+
+        const auto &tokens = streams[f];
+        REQUIRE(records.size() - at >= tokens.size() * jsv::TokenWriter::binary_record_bytes);
+        for(std::size_t i = 0; i < tokens.size(); ++i, at += jsv::TokenWriter::binary_record_bytes) {
+            REQUIRE(static_cast<jsv::TokenKind>(records[at]) == tokens.kinds()[i]);
+            REQUIRE(field(at + 1, 8) == tokens.offsets()[i]);
+            REQUIRE(field(at + 9, 4) == tokens.lengths()[i]);
+            REQUIRE(field(at + 13, 4) == tokens.payloads()[i]);
+        }
+        REQUIRE(tokens.kinds().back() == jsv::TokenKind::Eof);
+    }
+    REQUIRE(at == records.size());
+}
+
+TEST_CASE("TokenWriter_FlushesInLargeBlocks", "[driver][dump]") {
+    std::string source;
+    for(std::size_t i = 0; i < 100'000; ++i) { source += "var x = y;\n"; }
+    jsv::Lexer lexer{source, "big.vn"};
+    jsv::TokenStream tokens;
+    lexer.tokenize_into(tokens);
+
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::tmpfile(), &std::fclose};
+    REQUIRE(file != nullptr);
+    jsv::TokenWriter writer{file.get(), jsv::TokenFormat::Text};
+    writer.set_file("big.vn");
+    writer.write(tokens, source);
+    // Written out while dumping, in blocks of at least `flush_bytes`.
+    REQUIRE(writer.bytes_written() >= jsv::TokenWriter::flush_bytes);
+    writer.flush();
+    REQUIRE(std::ftell(file.get()) == static_cast<long>(writer.bytes_written()));
+}
+
+TEST_CASE("TokenWriter_StreamTokensCarryOffsets", "[driver][dump]") {
+    const std::unique_ptr<std::FILE, int (*)(std::FILE *)> file{std::tmpfile(), &std::fclose};
+    REQUIRE(file != nullptr);
+    {
+        jsv::TokenWriter writer{file.get(), jsv::TokenFormat::Text};
+        writer.set_file("s.vn");
+        // Each token is written before the next `next` call invalidates its text.
+        std::istringstream input{"a\nb"};
+        jsv::StreamingLexer lexer{input, "s.vn", jsv::StreamLexOptions{.window_bytes = 4, .max_token_bytes = 4}};
+        for(auto token = lexer.next();; token = lexer.next()) {
+            writer.write(token);
+            if(token.kind == jsv::TokenKind::Eof) { break; }
+        }
+    }
+    std::rewind(file.get());
+    std::array<char, 256> chunk{};
+    const std::string out(chunk.data(), std::fread(chunk.data(), 1, chunk.size(), file.get()));
+    REQUIRE(out.starts_with(FORMAT("{}(\"a\") s.vn:offset 0\n", jsv::tokenKindToString(jsv::TokenKind::IdentifierAscii))));
+    REQUIRE(out.ends_with(FORMAT("{}(\"\") s.vn:offset 3\n", jsv::tokenKindToString(jsv::TokenKind::Eof))));
+}
+
 // clang-format off
 // NOLINTEND(*-include-cleaner, *-avoid-magic-numbers, *-magic-numbers, *-unchecked-optional-access, *-avoid-do-while, *-use-anonymous-namespace, *-qualified-auto, *-suspicious-stringview-data-usage, *-err58-cpp, *-function-cognitive-complexity, *-macro-usage, *-unnecessary-copy-initialization, *-uppercase-literal-suffix, *-uppercase-literal-suffix, *-container-size-empty, *-move-const-arg, *-move-const-arg, *-pass-by-value, *-diagnostic-self-assign-overloaded, *-unused-using-decls, *-identifier-length)
 // clang-format on
\ No newline at end of file